@@ -0,0 +1,92 @@
+/// @file     absorber_check.cpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    Reflection check: absorbing layer next to the frontier.
+/// @details  Sends a right-moving Gaussian pulse on a 1D chain into an absorbing layer in front of
+///           the fixed end (its link released, as in main.cpp) and measures the fraction of its energy
+///           that comes back, for pulses wider and narrower than the layer. Longitudinal waves at
+///           normal incidence only: the 3D lattice has different P and S impedances.
+
+#include <cstdio>
+#include <cstdlib>
+#include "chain.hpp"
+
+#define NODES      300                                                                               // Chain nodes (outside the layer) [#].
+#define START      100.0f                                                                            // Pulse initial position [#cells].
+#define WIDTH      8.0f                                                                              // Pulse width [#cells].
+#define NARROW     2.0f                                                                              // Narrow pulse width [#cells].
+#define AMPLITUDE  0.1f                                                                              // Pulse amplitude [m].
+#define SAFETY_CFL 0.5f                                                                              // Explicit safety coefficient (as in main.cpp).
+#define ABSORPTION 1.0f                                                                              // Absorption (as in main.cpp).
+#define LAYER      2                                                                                 // Checked layer thickness (maximum on spacetime.msh for R = 3) [#cells].
+#define REFLECTION 0.02f                                                                             // Maximum reflected energy fraction at LAYER (wide pulse) [].
+#define NARROW_MAX 0.1f                                                                              // Maximum reflected energy fraction at LAYER (narrow pulse) [].
+
+// Reflected energy fraction for a "layer" cells thick absorbing layer:
+static float reflection (int layer, float width)
+{
+  chain  c (NODES + layer, 1.0f, 1.0f, 0.0f, 1.0f);                                                  // Unit chain.
+  float  speed = c.ds/c.critical ();                                                                 // Wave speed [m/s].
+  float  E_0;
+  size_t depth;
+  size_t i;
+  size_t n;
+
+  // Same profile as absorbing() and anchoring() in main.cpp (depth counted in cells from the frontier):
+  for(i = 0; i < c.nodes; i++)
+  {
+    depth = c.nodes - 1 - i;                                                                         // Computing node depth...
+
+    if((depth >= 1) && ((int)depth <= layer))
+    {
+      c.sigma[i] = ABSORPTION*std::sqrt (c.k*c.m)*std::pow ((layer + 1 - (float)depth)/layer, 3.0f); // Setting layer damping...
+    }
+  }
+
+  if(layer > 0)
+  {
+    c.anchor[c.nodes - 2] = 0.0f;                                                                    // Releasing frontier link...
+  }
+
+  for(i = 1; i < (c.nodes - 1); i++)
+  {
+    float x = (i - START)/width;                                                                     // Pulse coordinate...
+
+    c.p[i] += AMPLITUDE*std::exp (-x*x);                                                             // Setting pulse displacement...
+    c.v[i]  = speed*2.0f*x/width*AMPLITUDE*std::exp (-x*x);                                          // Setting right-moving pulse velocity...
+  }
+
+  E_0  = c.energy (0, NODES);                                                                        // Computing pulse energy...
+  c.dt = SAFETY_CFL*c.critical ();                                                                   // Setting time step...
+  n    = (size_t)std::lround (2.0f*(NODES - START)/speed/c.dt);                                      // Going to the frontier and back...
+
+  for(i = 0; i < n; i++)
+  {
+    c.explicit_step ();                                                                              // Explicit step...
+  }
+
+  return c.energy (0, NODES)/E_0;                                                                    // Computing reflected fraction...
+}
+
+int main ()
+{
+  int   layers[] = {0, 1, 2, 3, 4, 10};                                                              // Checked layer thicknesses [#cells].
+  float R_wide   = reflection (LAYER, WIDTH);                                                        // Reflection at LAYER cells (wide pulse)...
+  float R_narrow = reflection (LAYER, NARROW);                                                       // Reflection at LAYER cells (narrow pulse)...
+
+  printf ("layer [#cells] absorption reflected energy [] (width %.0f) reflected energy [] (width %.0f)\n", WIDTH, NARROW);
+
+  for(int layer : layers)
+  {
+    printf ("%-14d %-10.2f %-30.4g %.4g\n", layer, ABSORPTION, reflection (layer, WIDTH), reflection (layer, NARROW));
+  }
+
+  if(!std::isfinite (R_wide) || !std::isfinite (R_narrow) || (R_wide > REFLECTION) || (R_narrow > NARROW_MAX))
+  {
+    printf ("FAILED: reflected energy above %.2f (width %.0f) or %.2f (width %.0f) at %d cells.\n", REFLECTION, WIDTH, NARROW_MAX, NARROW, LAYER);
+    return EXIT_FAILURE;
+  }
+
+  printf ("PASSED\n");
+  return EXIT_SUCCESS;
+}
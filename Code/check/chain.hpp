@@ -0,0 +1,150 @@
+/// @file     chain.hpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    1D spring chain mirroring the spinor kernels (host-side checks).
+/// @details  The step function reproduces, node by node, the update of the explicit OpenCL kernels
+///           on a longitudinal chain with fixed ends and zero dispersion (so the radiated energy of
+///           kernel 2 vanishes), without the FLT_EPSILON truncations of utilities.cl. The semi-implicit
+///           kernels are mirrored, in 3D and with those truncations, by lattice.hpp.
+
+#ifndef chain_hpp
+#define chain_hpp
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+
+struct chain
+{
+  size_t             nodes;                                                                          // Number of nodes [#].
+  float              m;                                                                              // Node mass [kg].
+  float              k;                                                                              // Link stiffness [N/m].
+  float              beta;                                                                           // Link friction [N*s/m].
+  float              ds;                                                                             // Cell size [m].
+  float              dt;                                                                             // Simulation time step [s].
+  std::vector<float> p;                                                                              // Position [m].
+  std::vector<float> v;                                                                              // Velocity [m/s].
+  std::vector<float> a;                                                                              // Acceleration [m/s^2].
+  std::vector<float> fixed;                                                                          // Constrained position [m].
+  std::vector<float> sigma;                                                                          // Absorbing layer damping [kg/s].
+  std::vector<float> anchor;                                                                         // Link stiffness factor (link "i" joins nodes "i" and "i + 1") [].
+
+  chain (size_t n, float mass, float stiff, float friction, float cell)
+  {
+    nodes = n;                                                                                       // Setting number of nodes...
+    m     = mass;                                                                                    // Setting node mass...
+    k     = stiff;                                                                                   // Setting link stiffness...
+    beta  = friction;                                                                                // Setting link friction...
+    ds    = cell;                                                                                    // Setting cell size...
+    dt    = 0.0f;                                                                                    // Resetting time step...
+    p.assign (n, 0.0f);                                                                              // Resetting position...
+    v.assign (n, 0.0f);                                                                              // Resetting velocity...
+    a.assign (n, 0.0f);                                                                              // Resetting acceleration...
+    sigma.assign (n, 0.0f);                                                                          // Resetting absorbing layer...
+    anchor.assign (n - 1, 1.0f);                                                                     // Anchoring all links...
+
+    for(size_t i = 0; i < n; i++)
+    {
+      p[i] = i*ds;                                                                                   // Setting resting position...
+    }
+
+    fixed = {p[0], p[n - 1]};                                                                        // Fixing both ends...
+  }
+
+  /// Explicit stability limit of the chain (2/omega_max), equal to its CFL time step ds/c.
+  float critical () const
+  {
+    return std::sqrt (m/k);
+  }
+
+  bool free (size_t i) const
+  {
+    return (i > 0) && (i < (nodes - 1));
+  }
+
+  /// Total force upon node "i" at positions "x" and velocities "w" (kernels 3 and 4).
+  float force (size_t i, const std::vector<float>& x, const std::vector<float>& w) const
+  {
+    float F = -sigma[i]*w[i];                                                                        // Absorbing layer force...
+
+    for(int side = -1; side <= 1; side += 2)
+    {
+      if(((side < 0) && (i == 0)) || ((side > 0) && (i == (nodes - 1))))
+      {
+        continue;
+      }
+
+      size_t n         = i + side;                                                                   // Neighbour index...
+      float  link      = x[i] - x[n];                                                                // Link vector...
+      float  direction = (link < 0.0f) ? -1.0f : 1.0f;                                               // Link direction...
+      float  S         = std::fabs (link) - ds;                                                      // Link strain...
+      float  V         = (w[i] - w[n])*direction;                                                    // Link rate...
+
+      F += (-k*anchor[std::min (i, n)]*S - beta*V)*direction;                                        // Spring and dashpot forces...
+    }
+
+    return F;
+  }
+
+  /// Explicit predictor/estimator/corrector step (kernels 1, 3 and 4).
+  void explicit_step ()
+  {
+    std::vector<float> v_int (nodes);
+    std::vector<float> v_est (nodes);
+    std::vector<float> a_est (nodes);
+
+    // Kernel 1:
+    for(size_t i = 0; i < nodes; i++)
+    {
+      if(!free (i))
+      {
+        v[i] = 0.0f;                                                                                 // Constraining velocity...
+        a[i] = 0.0f;                                                                                 // Constraining acceleration...
+        p[i] = fixed[(i == 0) ? 0 : 1];                                                              // Constraining position...
+      }
+
+      p[i]     = p[i] + dt*v[i] + 0.5f*dt*dt*a[i];                                                   // Computing new position...
+      v_int[i] = v[i] + dt*a[i];                                                                     // Computing intermediate velocity...
+    }
+
+    // Kernel 3:
+    for(size_t i = 0; i < nodes; i++)
+    {
+      a_est[i] = force (i, p, v_int)/m;                                                              // Computing acceleration estimation...
+      v_est[i] = v[i] + 0.5f*dt*(a[i] + a_est[i]);                                                   // Computing velocity estimation...
+    }
+
+    // Kernel 4:
+    for(size_t i = 0; i < nodes; i++)
+    {
+      a_est[i] = free (i) ? force (i, p, v_est)/m : 0.0f;                                            // Computing new acceleration...
+    }
+
+    for(size_t i = 0; i < nodes; i++)
+    {
+      v[i] = free (i) ? v[i] + 0.5f*dt*(a[i] + a_est[i]) : 0.0f;                                     // Computing new velocity...
+      a[i] = a_est[i];                                                                               // Updating acceleration...
+    }
+  }
+
+  /// Kinetic plus elastic energy of the nodes in [begin, end).
+  float energy (size_t begin, size_t end) const
+  {
+    float E = 0.0f;
+
+    for(size_t i = begin; i < end; i++)
+    {
+      E += 0.5f*m*v[i]*v[i];                                                                         // Kinetic energy...
+
+      if(i < (nodes - 1))
+      {
+        E += 0.5f*k*anchor[i]*std::pow (std::fabs (p[i + 1] - p[i]) - ds, 2.0f);                     // Elastic energy...
+      }
+    }
+
+    return E;
+  }
+};
+
+#endif
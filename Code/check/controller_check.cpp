@@ -0,0 +1,258 @@
+/// @file     controller_check.cpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    Adaptive time step check: accept/reject/grow controller on the kernel mirror.
+/// @details  Runs frames as main.cpp does in adaptive mode (kernel 9 backup, kernel 11 monitor after
+///           every step, kernel 13 energy at the end of the frame, adapt() of integrator.hpp, kernel 10
+///           restore on rejection) on the lattice.hpp mirror with the default material, and checks that:
+///           1. a NaN velocity reaches the monitor through the kernel 11 reduction (adjzero would have
+///              turned it into zero) and the frame is rejected;
+///           2. a forced unstable frame (explicit, at SAFETY_UNSTABLE times dt_CFL, beyond the explicit
+///              limit) is rejected and run again at half the time step, until accepted with a finite
+///              state;
+///           3. a quiet run started at dt_min grows back to dt_max and stays there, for both
+///              integrators, within the number of frames the 10% growth needs (plus MARGIN).
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "lattice.hpp"
+#include "../src/integrator.hpp"
+
+#define SIDE            8                                                                            // Lattice nodes per side [#].
+#define STEPS           4                                                                            // Steps per frame [#].
+#define NOISE           1.0E-3f                                                                      // Quiet run random displacement [#cells].
+#define DISTURBANCE     1.0E-2f                                                                      // Unstable frame random displacement [#cells].
+#define SAFETY_UNSTABLE 8.0f                                                                         // Forced unstable explicit time step [dt_CFL].
+#define MARGIN          10                                                                           // Extra frames allowed to reach dt_max [#].
+#define QUIET           20                                                                           // Frames checked at dt_max [#].
+
+// Default material and controller settings (as in main.cpp, N = 3):
+static const float rho        = 1.0E-2f;                                                             // Mass density [kg/m^3].
+static const float E          = 1.0E-2f;                                                             // Young's modulus [Pa].
+static const float nu         = 0.2f;                                                                // Poisson's ratio [].
+static const float beta       = 1.0E-4f;                                                             // Damping [kg*s*m].
+static const float ds         = 0.1f;                                                                // Cell size [m].
+static const float dm         = rho*ds*ds*ds;                                                        // Node mass [kg].
+static const float lambda     = (E*nu)/((1.0f + nu)*(1.0f - 2.0f*nu));                               // 1st Lamé parameter [Pa].
+static const float mu         = E/(2.0f*(1.0f + nu));                                                // 2nd Lamé parameter [Pa].
+static const float M          = E*(1.0f - nu)/((1.0f + nu)*(1.0f - 2.0f*nu));                        // P-wave modulus [Pa].
+static const float Q          = (lambda - mu)/(mu*(1.0f + 2.0f/3.0f));                               // Dispersive to direct momentum flow ratio [].
+static const float C          = mu + mu*std::fabs (Q);                                               // Interaction momentum carriers pressure [Pa].
+static const float D          = Q/(1.0f + std::fabs (Q));                                            // Dispersion fraction [].
+static const float k          = 5.0f/(2.0f + 4.0f*std::sqrt (2.0f))*C*ds;                            // Spring constant [N/m].
+static const float dt_CFL     = ds/(3.0f*(std::sqrt (M/rho) + std::sqrt (mu/rho)));                  // Courant-Friedrichs-Lewy time step [s].
+static const float safety_SI  = 8.0f;                                                                // Semi-implicit time step coefficient [].
+static const int   sweeps     = 2;                                                                   // Semi-implicit Jacobi sweeps (pairs) [#].
+static const float safety_max = 0.6f;                                                                // Adaptive explicit maximum time step coefficient [].
+static const float safety_min = 0.05f;                                                               // Adaptive minimum time step coefficient [].
+static const float strain_max = 1.0E-2f;                                                             // Maximum link strain increment per step [].
+static const float travel_max = 1.0E-1f;                                                             // Maximum node travel per step [#cells].
+static const float drift_max  = 1.0E-2f;                                                             // Maximum energy drift per frame (undriven) [].
+
+// Lattice at rest with random displacements of "amplitude" cells:
+static lattice disturbed (float amplitude)
+{
+  lattice                               l (SIDE, ds, dm, k, beta, D);
+  std::mt19937                          generator (1);
+  std::uniform_real_distribution<float> random (-amplitude*ds, amplitude*ds);
+
+  for(size_t i = 0; i < l.nodes; i++)
+  {
+    if(l.freedom[i] > 0.0f)
+    {
+      l.p[i] += {random (generator), random (generator), random (generator)};                        // Setting random displacement...
+    }
+  }
+
+  return l;
+}
+
+// Runs STEPS steps at time step "dt", with the monitor of main.cpp:
+static void run (lattice& l, float dt, bool semi_implicit)
+{
+  l.dt         = dt;                                                                                 // Setting time step...
+  l.monitor[0] = l.monitor[1] = l.monitor[2] = 0.0f;                                                 // Resetting stability monitor...
+
+  for(int s = 0; s < STEPS; s++)
+  {
+    if(semi_implicit)
+    {
+      l.semi_implicit_step (sweeps);                                                                 // Semi-implicit step...
+    }
+    else
+    {
+      l.explicit_step ();                                                                            // Explicit step...
+    }
+
+    l.kernel_11 ();                                                                                  // Monitoring step...
+  }
+
+  l.kernel_13 ();                                                                                    // Monitoring frame energy...
+}
+
+// Runs one adaptive frame as main.cpp does, returning the number of rejected attempts:
+static int frame (lattice& l, float& dt, float& energy_old, bool& driven, bool semi_implicit, std::vector<float>& tried)
+{
+  float dt_max   = (semi_implicit ? safety_SI : safety_max)*dt_CFL;                                  // Maximum time step [s].
+  float dt_min   = safety_min*dt_CFL;                                                                // Minimum time step [s].
+  int   rejected = 0;
+  bool  accepted;
+
+  l.kernel_9 ();                                                                                     // Backing up kinematics...
+
+  do
+  {
+    tried.push_back (dt);                                                                            // Recording time step...
+    run (l, dt, semi_implicit);                                                                      // Running frame...
+    accepted = adapt (
+                      dt,
+                      dt_min,
+                      dt_max,
+                      l.monitor[0]*dt,
+                      l.monitor[1]*dt/ds,
+                      l.monitor[2],
+                      energy_old,
+                      driven,
+                      strain_max,
+                      travel_max,
+                      drift_max
+                     );                                                                              // Judging frame...
+
+    if(accepted)
+    {
+      driven = false;                                                                                // Resetting external drive flag...
+    }
+    else
+    {
+      l.kernel_10 ();                                                                                // Restoring kinematics...
+      rejected++;                                                                                    // Counting rejected frames...
+    }
+  } while(!accepted);
+
+  return rejected;
+}
+
+// True if all positions are finite:
+static bool finite (const lattice& l)
+{
+  for(size_t i = 0; i < l.nodes; i++)
+  {
+    if(!std::isfinite (length (l.p[i])))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+int main ()
+{
+  bool               passed = true;
+  std::vector<float> tried;
+  float              dt;
+  float              energy_old;
+  bool               driven;
+  int                rejected;
+
+  printf ("dt_CFL = %.4g s, dt_min = %.2f dt_CFL, dt_max = %.2f (explicit) %.2f (semi-implicit) dt_CFL\n",
+          dt_CFL, safety_min, safety_max, safety_SI);
+
+  // 1. NaN reaching the monitor:
+  {
+    lattice l       = disturbed (NOISE);
+    float   old     = 0.0f;
+    float   dt_NaN  = safety_max*dt_CFL;
+    size_t  n       = l.nodes/2 + l.side/2;                                                          // Central (free) node...
+
+    l.v[n].x = NAN;                                                                                  // Forcing NaN...
+    l.kernel_11 ();                                                                                  // Monitoring...
+    printf ("NaN velocity: monitor = (%g, %g), adjzero = %g\n", l.monitor[0], l.monitor[1], adjzero (l.v[n].x));
+
+    if(!std::isnan (l.monitor[0]) || !std::isnan (l.monitor[1]) ||
+       adapt (dt_NaN, safety_min*dt_CFL, safety_max*dt_CFL, l.monitor[0]*dt_NaN, l.monitor[1]*dt_NaN/ds, 0.0f, old,
+              true, strain_max, travel_max, drift_max))
+    {
+      printf ("FAILED: NaN velocity not reaching the monitor or not rejected.\n");
+      passed = false;
+    }
+  }
+
+  // 2. Forced unstable frame:
+  {
+    lattice l = disturbed (DISTURBANCE);
+
+    dt         = SAFETY_UNSTABLE*dt_CFL;                                                             // Forcing unstable time step...
+    energy_old = 0.0f;
+    driven     = true;
+    tried.clear ();
+    rejected   = frame (l, dt, energy_old, driven, false, tried);
+    printf ("unstable frame: %d rejections, tried", rejected);
+
+    for(float t : tried)
+    {
+      printf (" %.3g", t/dt_CFL);
+    }
+
+    printf (" dt_CFL\n");
+
+    for(size_t i = 1; i < tried.size (); i++)
+    {
+      if(std::fabs (tried[i] - std::max (0.5f*tried[i - 1], safety_min*dt_CFL)) > 1.0E-6f*tried[i - 1])
+      {
+        printf ("FAILED: rejected frame not run again at half the time step.\n");
+        passed = false;
+      }
+    }
+
+    if((rejected < 1) || !finite (l))
+    {
+      printf ("FAILED: unstable frame not rejected or final state not finite.\n");
+      passed = false;
+    }
+  }
+
+  // 3. Quiet run growing back to dt_max:
+  for(bool semi_implicit : {false, true})
+  {
+    lattice l      = disturbed (NOISE);
+    float   dt_max = (semi_implicit ? safety_SI : safety_max)*dt_CFL;                                // Maximum time step [s].
+    int     frames = (int)std::ceil (std::log (dt_max/(safety_min*dt_CFL))/std::log (1.1f)) + MARGIN; // Frames allowed to reach dt_max [#].
+    int     f      = 0;
+
+    dt         = safety_min*dt_CFL;                                                                  // Starting from the minimum time step...
+    energy_old = 0.0f;
+    driven     = true;
+    rejected   = 0;
+
+    while((f < frames) && (dt < dt_max))
+    {
+      rejected += frame (l, dt, energy_old, driven, semi_implicit, tried);                           // Running frame...
+      f++;
+    }
+
+    for(int q = 0; q < QUIET; q++)
+    {
+      rejected += frame (l, dt, energy_old, driven, semi_implicit, tried);                           // Running frame at dt_max...
+    }
+
+    printf ("%-13s quiet run: dt_max reached in %d frames (%d allowed), %d rejections, dt = %.3g dt_CFL\n",
+            semi_implicit ? "semi-implicit" : "explicit", f, frames, rejected, dt/dt_CFL);
+
+    if((dt < dt_max) || (rejected > 0) || !finite (l))
+    {
+      printf ("FAILED: quiet run not growing back to dt_max, or rejected.\n");
+      passed = false;
+    }
+  }
+
+  if(!passed)
+  {
+    return EXIT_FAILURE;
+  }
+
+  printf ("PASSED\n");
+  return EXIT_SUCCESS;
+}
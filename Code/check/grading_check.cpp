@@ -0,0 +1,153 @@
+/// @file     grading_check.cpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    Per-link check: graded lattice.
+/// @details  Grades the lattice of spacetime.msh (22 nodes per side, fine core as in main.cpp for the
+///           default particle radius) with the functions of grading.hpp used by main.cpp, then checks:
+///           1. the size ratio of neighbouring cells along an axis stays within GRADING_RATIO;
+///           2. the axial modulus (link stiffness times squared link length over the volume of its
+///              nodes) and the wave speed (square root of modulus over density) of every stiff link
+///              (1st and 2nd neighbours) between free nodes stay within TOLERANCE of the fine core
+///              ones. The node volumes are measured on the graded node positions, not taken from
+///              graded_stretch; links to the (fixed) frontier nodes are skipped, their mass being
+///              irrelevant.
+///           The same figures are printed for a grading above the limit, for comparison.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include "../src/grading.hpp"
+
+#define SIDE      22                                                                                 // Lattice nodes per side (as in spacetime.msh) [#].
+#define R         3                                                                                  // Particle's radius (as in main.cpp) [#cells].
+#define STEEP     10.0f                                                                              // Grading above the limit (comparison only) [1/m].
+#define TOLERANCE 0.05f                                                                              // Maximum relative modulus and wave speed error [].
+
+static const float ds     = 0.1f;                                                                    // Cell size [m].
+static const float dV     = ds*ds*ds;                                                                // Cell volume [m^3].
+static const float r_core = std::sqrt (3.0f)*ds*(R + 1) + ds;                                        // Fine core half-width (as in main.cpp) [m].
+
+// Lattice (uniform) coordinate of the "i"-th node along an axis:
+static float coordinate (int i)
+{
+  return (i - 0.5f*(SIDE - 1))*ds;
+}
+
+// Graded spacing around the "i"-th (free) node along an axis:
+static float spacing (int i, float grading)
+{
+  return 0.5f*(graded_coordinate (coordinate (i + 1), r_core, grading) -
+               graded_coordinate (coordinate (i - 1), r_core, grading));
+}
+
+// Maximum size ratio of neighbouring cells along an axis:
+static float ratio (float grading)
+{
+  float r = 1.0f;
+
+  for(int i = 1; i < (SIDE - 1); i++)
+  {
+    float h_0 = graded_coordinate (coordinate (i), r_core, grading) - graded_coordinate (coordinate (i - 1), r_core, grading);
+    float h_1 = graded_coordinate (coordinate (i + 1), r_core, grading) - graded_coordinate (coordinate (i), r_core, grading);
+
+    r = std::max ({r, h_1/h_0, h_0/h_1});                                                            // Finding maximum ratio...
+  }
+
+  return r;
+}
+
+// Maximum relative error of the link modulus (and of the wave speed) against the fine core ones:
+static void error (float grading, float& e_modulus, float& e_speed)
+{
+  e_modulus = 0.0f;
+  e_speed   = 0.0f;
+
+  for(int x = 0; x < SIDE; x++)
+  {
+    for(int y = 0; y < SIDE; y++)
+    {
+      for(int z = 0; z < SIDE; z++)
+      {
+        for(int dx = -1; dx <= 1; dx++)
+        {
+          for(int dy = -1; dy <= 1; dy++)
+          {
+            for(int dz = -1; dz <= 1; dz++)
+            {
+              int   hops = std::abs (dx) + std::abs (dy) + std::abs (dz);                            // Link hops [#].
+              int   a[3] = {x, y, z};                                                                // Central node.
+              int   b[3] = {x + dx, y + dy, z + dz};                                                 // Neighbour node.
+              float volume[2];                                                                       // Graded node volumes (from graded_stretch) [m^3].
+              float measured[2];                                                                     // Graded node volumes (from node positions) [m^3].
+              float L_0;                                                                             // Lattice link length [m].
+              float L;                                                                               // Graded link length [m].
+              float scale;                                                                           // Link stiffness scale [].
+              float modulus;                                                                         // Link modulus (relative to the fine core) [].
+
+              if((hops == 0) || (hops == 3) ||
+                 (std::min ({x, y, z, b[0], b[1], b[2]}) < 1) || (std::max ({x, y, z, b[0], b[1], b[2]}) > (SIDE - 2)))
+              {
+                continue;                                                                            // Skipping 3rd neighbours and frontier links...
+              }
+
+              L_0 = std::sqrt ((float)hops)*ds;                                                      // Computing lattice link length...
+              L   = 0.0f;
+
+              for(int n = 0; n < 2; n++)
+              {
+                int* node = n ? b : a;                                                               // Link end...
+
+                volume[n]   = dV;
+                measured[n] = 1.0f;
+
+                for(int axis = 0; axis < 3; axis++)
+                {
+                  volume[n]   *= graded_stretch (coordinate (node[axis]), r_core, grading);          // Computing node volume (as main.cpp)...
+                  measured[n] *= spacing (node[axis], grading);                                      // Measuring node volume...
+                }
+              }
+
+              for(int axis = 0; axis < 3; axis++)
+              {
+                L += std::pow (graded_coordinate (coordinate (b[axis]), r_core, grading) -
+                               graded_coordinate (coordinate (a[axis]), r_core, grading), 2.0f);     // Accumulating squared link length...
+              }
+
+              L         = std::sqrt (L);                                                             // Computing graded link length...
+              scale     = graded_scale (volume[0], volume[1], dV, L_0, L);                           // Computing link stiffness scale (as main.cpp)...
+              modulus   = scale*(L*L)/(0.5f*(measured[0] + measured[1]))/((L_0*L_0)/dV);             // Computing relative link modulus...
+              e_modulus = std::max (e_modulus, std::fabs (modulus - 1.0f));                          // Finding maximum modulus error...
+              e_speed   = std::max (e_speed, std::fabs (std::sqrt (modulus) - 1.0f));                // Finding maximum wave speed error...
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+int main ()
+{
+  float grading_max = graded_rate_max (ds);                                                          // Maximum grading [1/m].
+  float e_modulus;
+  float e_speed;
+  float r_max;
+
+  printf ("r_core = %.3f m, maximum grading = %.3f 1/m\n", r_core, grading_max);
+  printf ("grading [1/m] cell ratio [] modulus error [] wave speed error []\n");
+  error (STEEP, e_modulus, e_speed);
+  printf ("%-13.3f %-14.4g %-16.4g %.4g\n", STEEP, ratio (STEEP), e_modulus, e_speed);
+  error (grading_max, e_modulus, e_speed);
+  r_max = ratio (grading_max);
+  printf ("%-13.3f %-14.4g %-16.4g %.4g\n", grading_max, r_max, e_modulus, e_speed);
+
+  if((r_max > (GRADING_RATIO + 1.0E-3f)) || (e_modulus > TOLERANCE) || (e_speed > TOLERANCE))
+  {
+    printf ("FAILED: cell ratio above %.2f or link errors above %.2f at the maximum grading.\n", GRADING_RATIO, TOLERANCE);
+    return EXIT_FAILURE;
+  }
+
+  printf ("PASSED\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,242 @@
+/// @file     integrator_check.cpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    Stability and accuracy check: semi-implicit vs explicit integrator.
+/// @details  Runs the kernel mirror of lattice.hpp with the default material of main.cpp (dispersion
+///           and friction included), time steps being in units of main.cpp's dt_CFL:
+///           1. bisects the real explicit stability limit, with and without friction;
+///           2. runs the semi-implicit integrator for STEPS steps at every Jacobi sweep count the HUD
+///              allows (up to SWEEPS_MAX) and time steps up to SAFETY_SI_MAX, with and without friction
+///              and with a stiff absorbing damping next to the frontier, failing if any run diverges;
+///           3. compares both integrators, on a Gaussian pulse, against an explicit reference run at a
+///              10x smaller time step than main.cpp's, at the default semi-implicit time step (beyond
+///              the explicit limit).
+///           Not covered: the spinor and the lattice grading. The pulse is large enough for the
+///           FLT_EPSILON truncations of the explicit friction (mulzero (beta, -V)) to stay negligible:
+///           at much smaller amplitudes they, not the time step, dominate the difference between the
+///           two integrators.
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <algorithm>
+#include "lattice.hpp"
+#include "../src/integrator.hpp"
+
+#define SIDE       8                                                                                 // Lattice nodes per side (stability) [#].
+#define SIDE_PULSE 12                                                                                // Lattice nodes per side (accuracy) [#].
+#define STEPS      200                                                                               // Stability run length [#steps].
+#define NOISE      0.01f                                                                             // Stability run random displacement [#cells].
+#define DIVERGENCE 1.0f                                                                              // Divergent displacement [#cells].
+#define ABSORBING  10.0f                                                                             // Absorbing damping next to the frontier [sqrt(k*dm)].
+#define AMPLITUDE  0.5f                                                                              // Pulse amplitude [#cells].
+#define WIDTH      2.0f                                                                              // Pulse width [#cells].
+#define DURATION   80.0f                                                                             // Simulated time [dt_CFL].
+#define SAFETY_REF 0.05f                                                                             // Reference time step [dt_CFL].
+#define SAFETY_CFL 0.5f                                                                              // Explicit safety coefficient (as in main.cpp).
+#define SAFETY_SI  8.0f                                                                              // Semi-implicit time step (as in main.cpp) [dt_CFL].
+#define SWEEPS     2                                                                                 // Jacobi sweep pairs (as in main.cpp).
+#define ERROR_CFL  0.05f                                                                             // Maximum explicit error [amplitude].
+#define ERROR_SI   0.10f                                                                             // Maximum semi-implicit error [amplitude].
+
+// Default material (as in main.cpp, N = 3):
+static const float rho    = 1.0E-2f;                                                                 // Mass density [kg/m^3].
+static const float E      = 1.0E-2f;                                                                 // Young's modulus [Pa].
+static const float nu     = 0.2f;                                                                    // Poisson's ratio [].
+static const float beta   = 1.0E-4f;                                                                 // Damping [kg*s*m].
+static const float ds     = 0.1f;                                                                    // Cell size [m].
+static const float dm     = rho*ds*ds*ds;                                                            // Node mass [kg].
+static const float lambda = (E*nu)/((1.0f + nu)*(1.0f - 2.0f*nu));                                   // 1st Lamé parameter [Pa].
+static const float mu     = E/(2.0f*(1.0f + nu));                                                    // 2nd Lamé parameter [Pa].
+static const float M      = E*(1.0f - nu)/((1.0f + nu)*(1.0f - 2.0f*nu));                            // P-wave modulus [Pa].
+static const float Q      = (lambda - mu)/(mu*(1.0f + 2.0f/3.0f));                                   // Dispersive to direct momentum flow ratio [].
+static const float C      = mu + mu*std::fabs (Q);                                                   // Interaction momentum carriers pressure [Pa].
+static const float D      = Q/(1.0f + std::fabs (Q));                                                // Dispersion fraction [].
+static const float k      = 5.0f/(2.0f + 4.0f*std::sqrt (2.0f))*C*ds;                                // Spring constant [N/m].
+static const float dt_CFL = ds/(3.0f*(std::sqrt (M/rho) + std::sqrt (mu/rho)));                      // Courant-Friedrichs-Lewy time step [s].
+
+// Runs STEPS steps of "safety*dt_CFL" from random displacements, "sweeps" < 0 selecting the explicit integrator:
+static bool stable (float safety, int sweeps, float friction, float absorbing)
+{
+  lattice                               l (SIDE, ds, dm, k, friction, D);
+  std::vector<float3>                   rest = l.p;
+  std::mt19937                          generator (1);
+  std::uniform_real_distribution<float> random (-NOISE*ds, NOISE*ds);
+  size_t                                i;
+  int                                   s;
+
+  l.dt = safety*dt_CFL;                                                                              // Setting time step...
+
+  for(i = 0; i < l.nodes; i++)
+  {
+    float3 q = l.p[i];                                                                               // Node position...
+    float  r = std::max ({std::fabs (q.x), std::fabs (q.y), std::fabs (q.z)});                       // Node distance from the centre...
+
+    if(l.freedom[i] > 0.0f)
+    {
+      l.p[i] += {random (generator), random (generator), random (generator)};                        // Setting random displacement...
+    }
+
+    if(r > (0.5f*(SIDE - 1) - 1.5f)*ds)
+    {
+      l.sigma[i] = absorbing*std::sqrt (k*dm);                                                       // Setting absorbing damping (1st free shell)...
+    }
+  }
+
+  for(s = 0; s < STEPS; s++)
+  {
+    if(sweeps < 0)
+    {
+      l.explicit_step ();                                                                            // Explicit step...
+    }
+    else
+    {
+      l.semi_implicit_step (sweeps);                                                                 // Semi-implicit step...
+    }
+
+    for(i = 0; i < l.nodes; i++)
+    {
+      float e = length (l.p[i] - rest[i]);                                                           // Node displacement...
+
+      if(!std::isfinite (e) || (e > DIVERGENCE*ds))
+      {
+        return false;                                                                                // Diverging...
+      }
+    }
+  }
+
+  return true;
+}
+
+// Bisects the explicit stability limit [dt_CFL] (stable below "low", unstable above "high"):
+static float explicit_limit (float friction)
+{
+  float low  = SAFETY_REF;
+  float high = SAFETY_SI_MAX;
+
+  while((high - low) > 0.05f)
+  {
+    float middle = 0.5f*(low + high);
+
+    (stable (middle, -1, friction, 0.0f) ? low : high) = middle;                                     // Halving interval...
+  }
+
+  return low;
+}
+
+// Runs the pulse for DURATION with time step "safety*dt_CFL", "sweeps" < 0 selecting the explicit integrator:
+static std::vector<float3> run (float safety, int sweeps)
+{
+  lattice l (SIDE_PULSE, ds, dm, k, beta, D);
+  size_t  i;
+  size_t  n;
+
+  l.dt = safety*dt_CFL;                                                                              // Setting time step...
+  n    = (size_t)std::lround (DURATION/safety);                                                      // Computing number of steps...
+
+  for(i = 0; i < l.nodes; i++)
+  {
+    if(l.freedom[i] > 0.0f)
+    {
+      l.p[i].x += AMPLITUDE*ds*std::exp (-dot (l.p[i], l.p[i])/std::pow (WIDTH*ds, 2.0f));           // Setting initial pulse...
+    }
+  }
+
+  for(i = 0; i < n; i++)
+  {
+    if(sweeps < 0)
+    {
+      l.explicit_step ();                                                                            // Explicit step...
+    }
+    else
+    {
+      l.semi_implicit_step (sweeps);                                                                 // Semi-implicit step...
+    }
+  }
+
+  return l.p;
+}
+
+// Maximum displacement error against the reference, in units of the pulse amplitude:
+static float error (const std::vector<float3>& p, const std::vector<float3>& reference)
+{
+  float e = 0.0f;
+
+  for(size_t i = 0; i < p.size (); i++)
+  {
+    e = std::max (e, length (p[i] - reference[i])/(AMPLITUDE*ds));                                   // Finding maximum error...
+  }
+
+  return std::isfinite (e) ? e : INFINITY;
+}
+
+int main ()
+{
+  bool               passed    = true;
+  float              limit     = explicit_limit (beta);                                              // Explicit limit (friction)...
+  float              limit_0   = explicit_limit (0.0f);                                              // Explicit limit (no friction)...
+  std::vector<float> safety    = {1.0f, 2.0f, 4.0f, 8.0f, SAFETY_SI_MAX};
+  std::vector<float> friction  = {beta, 0.0f};
+  std::vector<float3> reference;
+  float              e_CFL;
+  float              e_SI;
+  int                sweeps;
+
+  printf ("dt_CFL = %.4g s, sqrt(dm/k) = %.4g s, D = %.3f\n", dt_CFL, std::sqrt (dm/k), D);
+  printf ("explicit limit: %.2f dt_CFL (friction), %.2f dt_CFL (no friction)\n", limit, limit_0);
+
+  if(SAFETY_SI <= std::max (limit, limit_0))
+  {
+    printf ("FAILED: default semi-implicit time step within the explicit limit.\n");
+    passed = false;
+  }
+
+  // Every sweep count the HUD allows, every time step up to SAFETY_SI_MAX:
+  for(float f : friction)
+  {
+    for(sweeps = 1; sweeps <= SWEEPS_MAX; sweeps++)
+    {
+      for(float s : safety)
+      {
+        if(!stable (s, sweeps, f, ABSORBING))
+        {
+          printf ("FAILED: semi-implicit diverges at %.1f dt_CFL, %d sweep pairs, beta = %g.\n", s, sweeps, f);
+          passed = false;
+        }
+      }
+    }
+  }
+
+  printf ("semi-implicit stable for %d steps: 1...%d sweep pairs, up to %.0f dt_CFL\n", STEPS, SWEEPS_MAX, SAFETY_SI_MAX);
+
+  // Accuracy trade-off:
+  reference = run (SAFETY_REF, -1);                                                                  // Computing reference...
+  e_CFL     = error (run (SAFETY_CFL, -1), reference);                                               // Explicit error...
+  e_SI      = error (run (SAFETY_SI, SWEEPS), reference);                                            // Semi-implicit error...
+
+  printf ("integrator     dt [dt_CFL] sweeps error [amplitude]\n");
+  printf ("explicit       %-11.2f %-6s %.4g\n", SAFETY_CFL, "-", e_CFL);
+  printf ("explicit       %-11.2f %-6s %.4g\n", SAFETY_SI, "-", error (run (SAFETY_SI, -1), reference));
+
+  for(float s : {2.0f, SAFETY_SI, SAFETY_SI_MAX})
+  {
+    for(sweeps = 1; sweeps <= 4; sweeps++)
+    {
+      printf ("semi-implicit  %-11.2f %-6d %.4g\n", s, sweeps, error (run (s, sweeps), reference));
+    }
+  }
+
+  if((e_CFL > ERROR_CFL) || (e_SI > ERROR_SI))
+  {
+    printf ("FAILED: errors above %.2f (explicit) or %.2f (semi-implicit).\n", ERROR_CFL, ERROR_SI);
+    passed = false;
+  }
+
+  if(!passed)
+  {
+    return EXIT_FAILURE;
+  }
+
+  printf ("PASSED\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,537 @@
+/// @file     lattice.hpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    3D cubic lattice mirroring the spinor kernels (host-side checks).
+/// @details  Each kernel function reproduces, node by node and with the same FLT_EPSILON truncations
+///           of utilities.cl, the update of the corresponding OpenCL kernel on a cubic lattice with
+///           26 neighbours per node (stiff 1st and 2nd neighbours, slack 3rd neighbours) and a fixed
+///           frontier, as built by main.cpp, dispersion and radiated energy included. The spinor and
+///           the lattice grading are not mirrored. The reductions of the adaptive time step monitor
+///           keep the integer ordering of atomic_max_positive, so that a NaN survives them as on the
+///           device.
+
+#ifndef lattice_hpp
+#define lattice_hpp
+
+#include <vector>
+#include <cmath>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+struct float3
+{
+  float x;
+  float y;
+  float z;
+};
+
+inline float3 operator + (float3 a, float3 b)
+{
+  return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+inline float3 operator - (float3 a, float3 b)
+{
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+inline float3& operator += (float3& a, float3 b)
+{
+  a = a + b;
+  return a;
+}
+
+inline float dot (float3 a, float3 b)
+{
+  return a.x*b.x + a.y*b.y + a.z*b.z;
+}
+
+inline float length (float3 a)
+{
+  return std::sqrt (dot (a, a));
+}
+
+// Same as utilities.cl:
+inline float adjzero (float v)
+{
+  return (std::fabs (v) > FLT_EPSILON) ? v : 0.0f;
+}
+
+inline float3 adjzero3 (float3 v)
+{
+  return {adjzero (v.x), adjzero (v.y), adjzero (v.z)};
+}
+
+inline float mulzero (float a, float b)
+{
+  float c = a*b;
+
+  if((std::fabs (a) < FLT_EPSILON) || (std::fabs (b) < FLT_EPSILON) || (std::fabs (c) < FLT_EPSILON))
+  {
+    c = 0.0f;
+  }
+
+  return c;
+}
+
+inline float3 mulzero3 (float a, float3 v)
+{
+  return {mulzero (a, v.x), mulzero (a, v.y), mulzero (a, v.z)};
+}
+
+inline float pownzero (float a, int n)
+{
+  float p = (float)std::pow (a, n);
+
+  if((std::fabs (a) < FLT_EPSILON) || (std::fabs (p) < FLT_EPSILON))
+  {
+    p = 0.0f;
+  }
+
+  return p;
+}
+
+inline float recipzero (float a)
+{
+  float b;
+
+  if(std::fabs (a) < FLT_EPSILON)
+  {
+    b = FLT_MAX;
+  }
+  else
+  {
+    b = 1.0f/a;
+
+    if(std::fabs (b) < FLT_EPSILON)
+    {
+      b = 0.0f;
+    }
+  }
+
+  return b;
+}
+
+inline void atomic_max_positive (float& p, float v)
+{
+  int32_t a;
+  int32_t b;
+
+  std::memcpy (&a, &p, sizeof (a));
+  std::memcpy (&b, &v, sizeof (b));
+
+  if(b > a)
+  {
+    p = v;                                                                                           // Updating maximum...
+  }
+}
+
+inline float3 normzero3 (float3 v)
+{
+  float L = length (v);
+
+  return (L > FLT_EPSILON) ? float3 {v.x/L, v.y/L, v.z/L} : float3 {0.0f, 0.0f, 0.0f};
+}
+
+struct lattice
+{
+  size_t              side;                                                                          // Nodes per side [#].
+  size_t              nodes;                                                                         // Number of nodes [#].
+  float               ds;                                                                            // Cell size [m].
+  float               D;                                                                             // Dispersion fraction [-0.5...1.0].
+  float               dt;                                                                            // Simulation time step [s].
+  std::vector<float3> p;                                                                             // Position [m] (position.xyz).
+  std::vector<float3> v;                                                                             // Velocity [m/s] (velocity.xyz).
+  std::vector<float3> v_int;                                                                         // Intermediate velocity [m/s] (velocity_int.xyz).
+  std::vector<float3> v_est;                                                                         // Estimated velocity [m/s] (velocity_est.xyz).
+  std::vector<float3> a;                                                                             // Acceleration [m/s^2] (acceleration.xyz).
+  std::vector<float>  freedom;                                                                       // Freedom flag [] (position.w).
+  std::vector<float>  beta;                                                                          // Friction [N*s/m] (velocity.w).
+  std::vector<float>  b;                                                                             // Stiff link count [#] (velocity_int.w).
+  std::vector<float>  Jacc;                                                                          // Radiated energy [J] (velocity_est.w).
+  std::vector<float>  m;                                                                             // Mass [kg] (acceleration.w).
+  std::vector<float>  sigma;                                                                         // Absorbing layer damping [kg/s] (damping).
+  std::vector<size_t> offset;                                                                        // Neighbour offsets [#].
+  std::vector<size_t> neighbour;                                                                     // Neighbour indices [#].
+  std::vector<float>  resting;                                                                       // Link resting lengths [m].
+  std::vector<float>  stiffness;                                                                     // Link stiffness [N/m].
+  std::vector<size_t> frontier;                                                                      // Frontier node indices [#].
+  std::vector<float3> frontier_pos;                                                                  // Frontier node positions [m].
+  std::vector<float3> p_bak;                                                                         // Position backup [m] (position_bak.xyz).
+  std::vector<float3> v_bak;                                                                         // Velocity backup [m/s] (velocity_bak.xyz).
+  std::vector<float3> a_bak;                                                                         // Acceleration backup [m/s^2] (acceleration_bak.xyz).
+  float               monitor[3];                                                                    // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
+
+  lattice (size_t n, float cell, float mass, float k, float friction, float dispersion)
+  {
+    side  = n;                                                                                       // Setting nodes per side...
+    nodes = n*n*n;                                                                                   // Setting number of nodes...
+    ds    = cell;                                                                                    // Setting cell size...
+    D     = dispersion;                                                                              // Setting dispersion fraction...
+    dt    = 0.0f;                                                                                    // Resetting time step...
+    p.resize (nodes);                                                                                // Allocating position...
+    v.assign (nodes, {0.0f, 0.0f, 0.0f});                                                            // Resetting velocity...
+    v_int.assign (nodes, {0.0f, 0.0f, 0.0f});                                                        // Resetting intermediate velocity...
+    v_est.assign (nodes, {0.0f, 0.0f, 0.0f});                                                        // Resetting estimated velocity...
+    a.assign (nodes, {0.0f, 0.0f, 0.0f});                                                            // Resetting acceleration...
+    freedom.assign (nodes, 1.0f);                                                                    // Setting freedom flag...
+    beta.assign (nodes, friction);                                                                   // Setting friction...
+    b.assign (nodes, 0.0f);                                                                          // Resetting stiff link count...
+    Jacc.assign (nodes, 0.0f);                                                                       // Resetting radiated energy...
+    m.assign (nodes, mass);                                                                          // Setting mass...
+    sigma.assign (nodes, 0.0f);                                                                      // Resetting absorbing layer...
+    monitor[0] = monitor[1] = monitor[2] = 0.0f;                                                     // Resetting stability monitor...
+
+    for(size_t i = 0; i < nodes; i++)
+    {
+      int x = (int)(i%n);                                                                            // Node x-index...
+      int y = (int)((i/n)%n);                                                                        // Node y-index...
+      int z = (int)(i/(n*n));                                                                        // Node z-index...
+
+      p[i] = {(x - 0.5f*(n - 1))*ds, (y - 0.5f*(n - 1))*ds, (z - 0.5f*(n - 1))*ds};                  // Setting resting position...
+
+      for(int dz = -1; dz <= 1; dz++)
+      {
+        for(int dy = -1; dy <= 1; dy++)
+        {
+          for(int dx = -1; dx <= 1; dx++)
+          {
+            int hops = std::abs (dx) + std::abs (dy) + std::abs (dz);                                // Neighbour order...
+
+            if((hops == 0) ||
+               (x + dx < 0) || (x + dx >= (int)n) ||
+               (y + dy < 0) || (y + dy >= (int)n) ||
+               (z + dz < 0) || (z + dz >= (int)n))
+            {
+              continue;
+            }
+
+            neighbour.push_back ((z + dz)*n*n + (y + dy)*n + (x + dx));                              // Setting neighbour index...
+            resting.push_back (ds*std::sqrt ((float)hops));                                          // Setting resting length...
+            stiffness.push_back ((hops < 3) ? k : 0.0f);                                             // Setting 1st and 2nd neighbour stiffness...
+          }
+        }
+      }
+
+      offset.push_back (neighbour.size ());                                                          // Setting neighbour offset...
+
+      if((x == 0) || (x == (int)(n - 1)) || (y == 0) || (y == (int)(n - 1)) || (z == 0) || (z == (int)(n - 1)))
+      {
+        freedom[i] = 0.0f;                                                                           // Resetting freedom flag...
+        frontier.push_back (i);                                                                      // Setting frontier index...
+        frontier_pos.push_back (p[i]);                                                               // Setting frontier position...
+      }
+    }
+  }
+
+  size_t begin (size_t n) const
+  {
+    return (n == 0) ? 0 : offset[n - 1];
+  }
+
+  /// Total force upon node "n" with velocities "w" (kernels 3, 4 and 5).
+  float3 force (size_t n, const std::vector<float3>& w) const
+  {
+    float3 Fdirect      = {0.0f, 0.0f, 0.0f};
+    float3 Fdissipative = {0.0f, 0.0f, 0.0f};
+    float3 Fviscous     = {0.0f, 0.0f, 0.0f};
+    float  d            = adjzero (D);
+
+    for(size_t j = begin (n); j < offset[n]; j++)
+    {
+      size_t k         = neighbour[j];
+      float3 link      = adjzero3 (adjzero3 (p[n]) - adjzero3 (p[k]));
+      float  L         = adjzero (length (link));
+      float3 direction = normzero3 (link);
+      float  V         = adjzero (dot (adjzero3 (adjzero3 (w[n]) - adjzero3 (w[k])), direction));
+      float  R         = adjzero (resting[j]);
+      float  S         = adjzero (L - R);
+      float  K         = adjzero (stiffness[j]);
+
+      Fdirect  += mulzero3 (adjzero (1.0f - std::fabs (d)), mulzero3 (mulzero (K, -S), direction));
+      Fviscous += mulzero3 (mulzero (adjzero (beta[n]), -V), direction);
+
+      if(K > FLT_EPSILON)
+      {
+        float JC = mulzero (adjzero (Jacc[n]), recipzero ((int)adjzero (b[n])));
+        float JN = mulzero (adjzero (Jacc[k]), recipzero ((int)adjzero (b[k])));
+
+        Fdissipative += mulzero3 (mulzero (JC + JN, recipzero (R)), direction);
+      }
+    }
+
+    return Fdirect + Fdissipative + Fviscous + mulzero3 (-adjzero (sigma[n]), adjzero3 (w[n]));
+  }
+
+  /// Kernel 1: explicit position prediction.
+  void kernel_1 ()
+  {
+    kernel_12 ();                                                                                    // Constraining position...
+
+    for(size_t i = 0; i < nodes; i++)
+    {
+      float3 vi = adjzero3 (v[i]);
+      float3 ai = adjzero3 (a[i]);
+      float  h  = adjzero (dt);
+
+      if(adjzero (freedom[i]) < FLT_EPSILON)
+      {
+        vi = {0.0f, 0.0f, 0.0f};                                                                     // Constraining velocity...
+        ai = {0.0f, 0.0f, 0.0f};                                                                     // Constraining acceleration...
+      }
+
+      p[i]     = adjzero3 (p[i]) + mulzero3 (h, vi) + mulzero3 (0.5f, mulzero3 (pownzero (h, 2), ai));
+      v_int[i] = vi + mulzero3 (h, ai);                                                              // Computing intermediate velocity...
+    }
+  }
+
+  /// Kernel 2: radiated energy and stiff link count.
+  void kernel_2 ()
+  {
+    for(size_t n = 0; n < nodes; n++)
+    {
+      Jacc[n] = 0.0f;                                                                                // Resetting radiated energy...
+      b[n]    = 0.0f;                                                                                // Resetting stiff link count...
+
+      for(size_t j = begin (n); j < offset[n]; j++)
+      {
+        float3 link = adjzero3 (adjzero3 (p[n]) - adjzero3 (p[neighbour[j]]));
+        float  R    = adjzero (resting[j]);
+        float  S    = adjzero (adjzero (length (link)) - R);
+        float  K    = adjzero (stiffness[j]);
+
+        if(K > FLT_EPSILON)
+        {
+          Jacc[n] += mulzero (0.5f, mulzero (adjzero (D), mulzero (mulzero (K, -S), R)));            // Building up radiated energy...
+          b[n]    += 1.0f;                                                                           // Counting stiff links...
+        }
+      }
+    }
+  }
+
+  /// Kernel 3: velocity estimation.
+  void kernel_3 ()
+  {
+    for(size_t n = 0; n < nodes; n++)
+    {
+      float3 a_est = mulzero3 (recipzero (adjzero (m[n])), force (n, v_int));
+
+      v_est[n] = adjzero3 (v[n]) + mulzero3 (0.5f, mulzero3 (adjzero (dt), adjzero3 (a[n]) + a_est));
+    }
+  }
+
+  /// Kernel 4: velocity and acceleration correction.
+  void kernel_4 ()
+  {
+    std::vector<float3> a_new (nodes);
+
+    for(size_t n = 0; n < nodes; n++)
+    {
+      a_new[n] = mulzero3 (recipzero (adjzero (m[n])), force (n, v_est));                            // Computing new acceleration...
+
+      if(adjzero (freedom[n]) < FLT_EPSILON)
+      {
+        a_new[n] = {0.0f, 0.0f, 0.0f};                                                               // Constraining acceleration...
+      }
+    }
+
+    for(size_t n = 0; n < nodes; n++)
+    {
+      v[n] = adjzero3 (v[n]) + mulzero3 (0.5f, mulzero3 (adjzero (dt), adjzero3 (a[n]) + a_new[n]));
+
+      if(adjzero (freedom[n]) < FLT_EPSILON)
+      {
+        v[n] = {0.0f, 0.0f, 0.0f};                                                                   // Constraining velocity...
+      }
+
+      a[n] = a_new[n];                                                                               // Updating acceleration...
+    }
+  }
+
+  /// Kernel 5: initial Jacobi iterate (start of step velocity).
+  void kernel_5 ()
+  {
+    for(size_t n = 0; n < nodes; n++)
+    {
+      v_int[n] = adjzero3 (v[n]);                                                                    // Setting initial iterate...
+
+      if(adjzero (freedom[n]) < FLT_EPSILON)
+      {
+        v_int[n] = {0.0f, 0.0f, 0.0f};                                                               // Constraining velocity...
+      }
+    }
+  }
+
+  /// Kernels 6 (from "v_int" to "v_est") and 7 (from "v_est" to "v_int"): Jacobi sweep, per unit mass.
+  void kernel_6 (const std::vector<float3>& u, std::vector<float3>& u_new) const
+  {
+    float d = adjzero (D);
+    float h = adjzero (dt);
+
+    for(size_t n = 0; n < nodes; n++)
+    {
+      float3 Adirect      = {0.0f, 0.0f, 0.0f};
+      float3 Adissipative = {0.0f, 0.0f, 0.0f};
+      float3 Uimplicit    = {0.0f, 0.0f, 0.0f};
+      float3 un           = adjzero3 (u[n]);
+      float3 diagonal     = {1.0f, 1.0f, 1.0f};
+      float  im           = recipzero (adjzero (m[n]));
+      float  damp         = mulzero (h, mulzero (adjzero (sigma[n]), im));
+
+      for(size_t j = begin (n); j < offset[n]; j++)
+      {
+        size_t k         = neighbour[j];
+        float3 link      = adjzero3 (adjzero3 (p[n]) - adjzero3 (p[k]));
+        float  L         = adjzero (length (link));
+        float3 direction = normzero3 (link);
+        float  V         = adjzero (dot (adjzero3 (un - adjzero3 (u[k])), direction));
+        float  R         = adjzero (resting[j]);
+        float  S         = adjzero (L - R);
+        float  K         = mulzero (adjzero (stiffness[j]), im);
+        float  c         = mulzero (h, mulzero (adjzero (beta[n]), im)) +
+                           mulzero (0.5f*pownzero (h, 2), mulzero (adjzero (1.0f - std::fabs (d)), K));
+        float  span      = std::fabs (direction.x) + std::fabs (direction.y) + std::fabs (direction.z);
+
+        Adirect   += mulzero3 (adjzero (1.0f - std::fabs (d)), mulzero3 (mulzero (K, -S), direction));
+        Uimplicit += mulzero3 (mulzero (c, V), direction);
+        diagonal  += mulzero3 (mulzero (c, span), {std::fabs (direction.x), std::fabs (direction.y), std::fabs (direction.z)});
+
+        if(adjzero (stiffness[j]) > FLT_EPSILON)
+        {
+          float JC = mulzero (adjzero (Jacc[n]), recipzero ((int)adjzero (b[n])));
+          float JN = mulzero (adjzero (Jacc[k]), recipzero ((int)adjzero (b[k])));
+
+          Adissipative += mulzero3 (mulzero (mulzero (JC + JN, im), recipzero (R)), direction);
+        }
+      }
+
+      float3 r = adjzero3 (v[n]) - un + mulzero3 (h, Adirect + Adissipative) - Uimplicit - mulzero3 (damp, un);
+
+      diagonal += {damp, damp, damp};
+      u_new[n]  = un + float3 {mulzero (recipzero (diagonal.x), r.x),
+                               mulzero (recipzero (diagonal.y), r.y),
+                               mulzero (recipzero (diagonal.z), r.z)};
+
+      if(adjzero (freedom[n]) < FLT_EPSILON)
+      {
+        u_new[n] = {0.0f, 0.0f, 0.0f};                                                               // Constraining velocity...
+      }
+    }
+  }
+
+  /// Kernel 8: position update.
+  void kernel_8 ()
+  {
+    for(size_t i = 0; i < nodes; i++)
+    {
+      float3 v_new = adjzero3 (v_int[i]);
+
+      if(adjzero (freedom[i]) < FLT_EPSILON)
+      {
+        v_new = {0.0f, 0.0f, 0.0f};                                                                  // Constraining velocity...
+      }
+
+      a[i]     = mulzero3 (recipzero (adjzero (dt)), v_new - adjzero3 (v[i]));                       // Computing new acceleration...
+      p[i]     = adjzero3 (p[i]) + mulzero3 (adjzero (dt), v_new);                                   // Computing new position...
+      v[i]     = v_new;                                                                              // Updating velocity...
+      v_int[i] = v_new;                                                                              // Updating intermediate velocity...
+    }
+  }
+
+  /// Kernel 9: kinematics backup.
+  void kernel_9 ()
+  {
+    p_bak = p;                                                                                       // Backing up position...
+    v_bak = v;                                                                                       // Backing up velocity...
+    a_bak = a;                                                                                       // Backing up acceleration...
+  }
+
+  /// Kernel 10: kinematics restore.
+  void kernel_10 ()
+  {
+    p = p_bak;                                                                                       // Restoring position...
+    v = v_bak;                                                                                       // Restoring velocity...
+    a = a_bak;                                                                                       // Restoring acceleration...
+  }
+
+  /// Kernel 11: maximum link strain rate and node speed, on the raw kinematics (NaN kept).
+  void kernel_11 ()
+  {
+    for(size_t n = 0; n < nodes; n++)
+    {
+      float rate_max = 0.0f;
+      float speed    = length (v[n]);
+
+      for(size_t j = begin (n); j < offset[n]; j++)
+      {
+        size_t k         = neighbour[j];
+        float3 direction = normzero3 (p[n] - p[k]);
+        float  rate      = std::fabs (dot (v[n] - v[k], direction))/resting[j];
+
+        rate_max = (std::isnan (rate_max) || std::isnan (rate)) ? NAN : std::fmax (rate_max, rate);
+      }
+
+      speed = (std::isnan (speed) || std::isnan (length (p[n]))) ? NAN : speed;                      // Keeping NaN...
+      atomic_max_positive (monitor[0], rate_max);                                                    // Reducing maximum link strain rate...
+      atomic_max_positive (monitor[1], speed);                                                       // Reducing maximum node speed...
+    }
+  }
+
+  /// Kernel 12: constraint snap.
+  void kernel_12 ()
+  {
+    for(size_t j = 0; j < frontier.size (); j++)
+    {
+      p[frontier[j]] = frontier_pos[j];                                                              // Constraining position...
+    }
+  }
+
+  /// Kernel 13: total energy.
+  void kernel_13 ()
+  {
+    for(size_t n = 0; n < nodes; n++)
+    {
+      float3 vn     = adjzero3 (v[n]);
+      float  energy = 0.0f;
+
+      for(size_t j = begin (n); j < offset[n]; j++)
+      {
+        float3 link = adjzero3 (adjzero3 (p[n]) - adjzero3 (p[neighbour[j]]));
+        float  S    = adjzero (adjzero (length (link)) - adjzero (resting[j]));
+
+        energy += 0.25f*(1.0f - std::fabs (adjzero (D)))*adjzero (stiffness[j])*S*S;                 // Building up elastic energy...
+      }
+
+      monitor[2] += energy + 0.5f*adjzero (m[n])*dot (vn, vn);                                       // Reducing total energy...
+    }
+  }
+
+  /// Explicit step (kernels 1, 2, 3 and 4, as dispatched by main.cpp).
+  void explicit_step ()
+  {
+    kernel_1 ();
+    kernel_2 ();
+    kernel_3 ();
+    kernel_4 ();
+  }
+
+  /// Semi-implicit step with "sweeps" pairs of damped Jacobi sweeps (kernels 12, 2, 5, 6/7 and 8).
+  void semi_implicit_step (int sweeps)
+  {
+    kernel_12 ();
+    kernel_2 ();
+    kernel_5 ();
+
+    for(int s = 0; s < sweeps; s++)
+    {
+      kernel_6 (v_int, v_est);
+      kernel_6 (v_est, v_int);
+    }
+
+    kernel_8 ();
+  }
+};
+
+#endif
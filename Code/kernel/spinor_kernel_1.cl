@@ -21,7 +21,12 @@ __kernel void thekernel(__global float4*    color,
                         __global int*       frontier_num,                             // Spacetime frontier cells number.
                         __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
                         __global float*     dispersion,                               // Dispersion fraction.
-                        __global float*     dt_simulation                             // Simulation time step.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
                         )                                 
 {
   //////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,41 @@
+/// @file     spinor_kernel_10.cl
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    10th kernel.
+/// @details  Adaptive time step: restores the kinematic state after a rejected step.
+__kernel void thekernel(__global float4*    color,                                    // vec4(color.xyz [], alpha []).
+                        __global float4*    position,                                 // vec4(position.xyz [m], freedom []).
+                        __global float4*    velocity,                                 // vec4(velocity.xyz [m/s], friction [N*s/m]).
+                        __global float4*    velocity_int,                             // vec4(velocity (intermediate) [m/s], number of 1st + 2nd nearest neighbours []).
+                        __global float4*    velocity_est,                             // vec4(velocity.xyz (estimation) [m/s], radiative energy [J]).
+                        __global float4*    acceleration,                             // vec4(acceleration.xyz [m/s^2], mass [kg]).
+                        __global float*     stiffness,                                // Stiffness.
+                        __global float*     resting,                                  // Resting distance.
+                        __global int*       central,                                  // Central.
+                        __global int*       neighbour,                                // Neighbour.
+                        __global int*       offset,                                   // Offset.
+                        __global int*       spinor,                                   // Spinor.
+                        __global int*       spinor_num,                               // Spinor cells number.
+                        __global float4*    spinor_pos,                               // Spinor cells position.
+                        __global int*       frontier,                                 // Spacetime frontier.
+                        __global int*       frontier_num,                             // Spacetime frontier cells number.
+                        __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
+                        __global float*     dispersion,                               // Dispersion fraction.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
+                        )
+{
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////// INDICES /////////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  unsigned long i = get_global_id(0);                                                 // Global index [#].
+
+  // RESTORING KINEMATICS:
+  position[i] = position_bak[i];                                                      // Restoring position...
+  velocity[i] = velocity_bak[i];                                                      // Restoring velocity...
+  acceleration[i] = acceleration_bak[i];                                              // Restoring acceleration...
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+/// @file     spinor_kernel_11.cl
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    11th kernel.
+/// @details  Adaptive time step: reduces maximum link strain rate and maximum node speed into "monitor" after
+///           every step, on the raw (non truncated) kinematics so that a NaN reaches the host.
+__kernel void thekernel(__global float4*    color,                                    // vec4(color.xyz [], alpha []).
+                        __global float4*    position,                                 // vec4(position.xyz [m], freedom []).
+                        __global float4*    velocity,                                 // vec4(velocity.xyz [m/s], friction [N*s/m]).
+                        __global float4*    velocity_int,                             // vec4(velocity (intermediate) [m/s], number of 1st + 2nd nearest neighbours []).
+                        __global float4*    velocity_est,                             // vec4(velocity.xyz (estimation) [m/s], radiative energy [J]).
+                        __global float4*    acceleration,                             // vec4(acceleration.xyz [m/s^2], mass [kg]).
+                        __global float*     stiffness,                                // Stiffness.
+                        __global float*     resting,                                  // Resting distance.
+                        __global int*       central,                                  // Central.
+                        __global int*       neighbour,                                // Neighbour.
+                        __global int*       offset,                                   // Offset.
+                        __global int*       spinor,                                   // Spinor.
+                        __global int*       spinor_num,                               // Spinor cells number.
+                        __global float4*    spinor_pos,                               // Spinor cells position.
+                        __global int*       frontier,                                 // Spacetime frontier.
+                        __global int*       frontier_num,                             // Spacetime frontier cells number.
+                        __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
+                        __global float*     dispersion,                               // Dispersion fraction.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
+                        )
+{
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////// INDEXES /////////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  unsigned int i = get_global_id(0);                                                  // Global index [#].
+  unsigned int j = 0;                                                                 // Neighbour stride index.
+  unsigned int j_min = 0;                                                             // Neighbour stride minimun index.
+  unsigned int j_max = offset[i];                                                     // Neighbour stride maximum index.
+  unsigned int k = 0;                                                                 // Neighbour tuple index.
+  unsigned int n = central[j_max - 1];                                                // Central node index.
+
+  //////////////////////////////////////////////////////////////////////////////////////
+  ///////////////////////////////////// CELL VARIABLES /////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  float3        p                 = position[n].xyz;                                  // Central node position (raw).
+  float3        v                 = velocity[n].xyz;                                  // Central node velocity (raw).
+  float3        direction         = (float3)(0.0f, 0.0f, 0.0f);                       // Neighbour link direction.
+  float         V                 = 0.0f;                                             // Neighbour rate strain.
+  float         rate              = 0.0f;                                             // Neighbour link strain rate [1/s].
+  float         rate_max          = 0.0f;                                             // Central node maximum link strain rate [1/s].
+  float         speed             = length(v);                                        // Central node speed [m/s].
+
+  // COMPUTING STRIDE MINIMUM INDEX:
+  if (i == 0)
+  {
+    j_min = 0;                                                                        // Setting stride minimum (first stride)...
+  }
+  else
+  {
+    j_min = offset[i - 1];                                                            // Setting stride minimum (all others)...
+  }
+
+  // COMPUTING LINK STRAIN RATE (fmax drops a NaN argument, hence a NaN is kept explicitly):
+  for (j = j_min; j < j_max; j++)
+  {
+    k = neighbour[j];                                                                 // Computing neighbour index...
+    direction = normzero3(p - position[k].xyz);                                       // Computing neighbour link direction...
+    V = dot(v - velocity[k].xyz, direction);                                          // Computing neighbour rate...
+    rate = fabs(V)/resting[j];                                                        // Computing neighbour link strain rate...
+    rate_max = (isnan(rate_max) || isnan(rate)) ? NAN : fmax(rate_max, rate);         // Updating maximum link strain rate...
+  }
+
+  speed = (isnan(speed) || isnan(length(p))) ? NAN : speed;                           // Keeping NaN...
+
+  // REDUCING MONITOR (a positive NaN is above +INF in the integer ordering of atomic_max_positive):
+  atomic_max_positive(&monitor[0], rate_max);                                         // Reducing maximum link strain rate...
+  atomic_max_positive(&monitor[1], speed);                                            // Reducing maximum node speed...
+}
\ No newline at end of file
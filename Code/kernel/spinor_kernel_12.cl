@@ -0,0 +1,65 @@
+/// @file     spinor_kernel_12.cl
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    12th kernel.
+/// @details  Semi-implicit integrator: applies spinor and frontier position constraints before the force kernels.
+__kernel void thekernel(__global float4*    color,                                    // vec4(color.xyz [], alpha []).
+                        __global float4*    position,                                 // vec4(position.xyz [m], freedom []).
+                        __global float4*    velocity,                                 // vec4(velocity.xyz [m/s], friction [N*s/m]).
+                        __global float4*    velocity_int,                             // vec4(velocity (intermediate) [m/s], number of 1st + 2nd nearest neighbours []).
+                        __global float4*    velocity_est,                             // vec4(velocity.xyz (estimation) [m/s], radiative energy [J]).
+                        __global float4*    acceleration,                             // vec4(acceleration.xyz [m/s^2], mass [kg]).
+                        __global float*     stiffness,                                // Stiffness.
+                        __global float*     resting,                                  // Resting distance.
+                        __global int*       central,                                  // Central.
+                        __global int*       neighbour,                                // Neighbour.
+                        __global int*       offset,                                   // Offset.
+                        __global int*       spinor,                                   // Spinor.
+                        __global int*       spinor_num,                               // Spinor cells number.
+                        __global float4*    spinor_pos,                               // Spinor cells position.
+                        __global int*       frontier,                                 // Spacetime frontier.
+                        __global int*       frontier_num,                             // Spacetime frontier cells number.
+                        __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
+                        __global float*     dispersion,                               // Dispersion fraction.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
+                        )
+{
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////// INDICES /////////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  unsigned long i = get_global_id(0);                                                 // Global index [#].
+  unsigned long j;
+
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// CELL VARIABLES //////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  float3        p                 = adjzero3(position[i].xyz);                        // Central node position.
+  int           s_num             = spinor_num[0];                                    // Spinor cells number.
+  int           f_num             = frontier_num[0];                                  // Spacetime frontier cells number.
+
+  // FINDING SPINOR:
+  for(j = 0; j < s_num; j++)
+  {
+    if(i == spinor[j])
+    {
+      p = spinor_pos[j].xyz;
+    }
+  }
+
+  // FINDING FRONTIER:
+  for(j = 0; j < f_num; j++)
+  {
+    if(i == frontier[j])
+    {
+      p = frontier_pos[j].xyz;
+    }
+  }
+
+  // UPDATING KINEMATICS:
+  position[i].xyz = p;                                                                // Updating constrained position...
+}
\ No newline at end of file
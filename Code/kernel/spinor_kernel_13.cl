@@ -0,0 +1,84 @@
+/// @file     spinor_kernel_13.cl
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    13th kernel.
+/// @details  Adaptive time step: reduces total energy into "monitor" at the end of the frame.
+__kernel void thekernel(__global float4*    color,                                    // vec4(color.xyz [], alpha []).
+                        __global float4*    position,                                 // vec4(position.xyz [m], freedom []).
+                        __global float4*    velocity,                                 // vec4(velocity.xyz [m/s], friction [N*s/m]).
+                        __global float4*    velocity_int,                             // vec4(velocity (intermediate) [m/s], number of 1st + 2nd nearest neighbours []).
+                        __global float4*    velocity_est,                             // vec4(velocity.xyz (estimation) [m/s], radiative energy [J]).
+                        __global float4*    acceleration,                             // vec4(acceleration.xyz [m/s^2], mass [kg]).
+                        __global float*     stiffness,                                // Stiffness.
+                        __global float*     resting,                                  // Resting distance.
+                        __global int*       central,                                  // Central.
+                        __global int*       neighbour,                                // Neighbour.
+                        __global int*       offset,                                   // Offset.
+                        __global int*       spinor,                                   // Spinor.
+                        __global int*       spinor_num,                               // Spinor cells number.
+                        __global float4*    spinor_pos,                               // Spinor cells position.
+                        __global int*       frontier,                                 // Spacetime frontier.
+                        __global int*       frontier_num,                             // Spacetime frontier cells number.
+                        __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
+                        __global float*     dispersion,                               // Dispersion fraction.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
+                        )
+{
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////// INDEXES /////////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  unsigned int i = get_global_id(0);                                                  // Global index [#].
+  unsigned int j = 0;                                                                 // Neighbour stride index.
+  unsigned int j_min = 0;                                                             // Neighbour stride minimun index.
+  unsigned int j_max = offset[i];                                                     // Neighbour stride maximum index.
+  unsigned int k = 0;                                                                 // Neighbour tuple index.
+  unsigned int n = central[j_max - 1];                                                // Central node index.
+
+  //////////////////////////////////////////////////////////////////////////////////////
+  ///////////////////////////////////// CELL VARIABLES /////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  float3        p                 = adjzero3(position[n].xyz);                        // Central node position.
+  float3        v                 = adjzero3(velocity[n].xyz);                        // Central node velocity.
+  float         m                 = adjzero(acceleration[n].w);                       // Central node mass.
+  float3        mate              = (float3)(0.0f, 0.0f, 0.0f);                       // Neighbour node position.
+  float3        link              = (float3)(0.0f, 0.0f, 0.0f);                       // Neighbour link.
+  float         R                 = 0.0f;                                             // Neighbour link resting length.
+  float         K                 = 0.0f;                                             // Neighbour link stiffness.
+  float         S                 = 0.0f;                                             // Neighbour link strain.
+  float         L                 = 0.0f;                                             // Neighbour link length.
+  float         D                 = adjzero(dispersion[0]);                           // Dispersion.
+  float         energy            = 0.0f;                                             // Central node energy [J].
+
+  // COMPUTING STRIDE MINIMUM INDEX:
+  if (i == 0)
+  {
+    j_min = 0;                                                                        // Setting stride minimum (first stride)...
+  }
+  else
+  {
+    j_min = offset[i - 1];                                                            // Setting stride minimum (all others)...
+  }
+
+  // COMPUTING ELASTIC ENERGY:
+  for (j = j_min; j < j_max; j++)
+  {
+    k = neighbour[j];                                                                 // Computing neighbour index...
+    mate = adjzero3(position[k].xyz);                                                 // Getting neighbour position...
+    link = adjzero3(p - mate);                                                        // Computing neighbour link vector...
+    L = adjzero(length(link));                                                        // Computing neighbour link length...
+    R = adjzero(resting[j]);                                                          // Getting neighbour link resting length...
+    S = adjzero(L - R);                                                               // Computing neighbour link strain...
+    K = adjzero(stiffness[j]);                                                        // Getting neighbour link stiffness...
+    energy += 0.25f*(1.0f - fabs(D))*K*S*S;                                           // Building up elastic energy (each link is shared by two nodes)...
+  }
+
+  energy += 0.5f*m*dot(v, v);                                                         // Adding kinetic energy...
+
+  // REDUCING MONITOR:
+  atomic_add_float(&monitor[2], energy);                                              // Reducing total energy...
+}
\ No newline at end of file
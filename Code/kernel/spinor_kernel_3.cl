@@ -21,7 +21,12 @@ __kernel void thekernel(__global float4*    color,
                         __global int*       frontier_num,                             // Spacetime frontier cells number.
                         __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
                         __global float*     dispersion,                               // Dispersion fraction.
-                        __global float*     dt_simulation                             // Simulation time step.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
                         )
 {
   //////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +79,8 @@ __kernel void thekernel(__global float4*    color,
   float         V                 = 0.0f;                                             // Neighbour rate strain.
   float         D                 = adjzero(dispersion[0]);                           // Dispersion.
   float         dt                = adjzero(dt_simulation[0]);                        // Simulation time step [s].
+  float         sigma             = adjzero(damping[n]);                              // Central node absorbing layer damping.
+  float3        Fabsorbing        = (float3)(0.0f, 0.0f, 0.0f);                       // Central node absorbing force.
 
   // COMPUTING STRIDE MINIMUM INDEX:
   if (i == 0)
@@ -119,7 +126,8 @@ __kernel void thekernel(__global float4*    color,
     }
   }
 
-  F = Fdirect + Fdissipative + Fviscous;                                              // Computing node total force...
+  Fabsorbing = mulzero3(-sigma, v_int);                                               // Computing absorbing layer force...
+  F = Fdirect + Fdissipative + Fviscous + Fabsorbing;                                 // Computing node total force...
   a_est = mulzero3(recipzero(m), F);                                                  // Computing new acceleration estimation...
   v_est = v + mulzero3(0.5f, mulzero3(dt, a + a_est));                                // Computing new velocity estimation...
 
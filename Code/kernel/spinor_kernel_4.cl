@@ -21,7 +21,12 @@ __kernel void thekernel(__global float4*    color,
                         __global int*       frontier_num,                             // Spacetime frontier cells number.
                         __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
                         __global float*     dispersion,                               // Dispersion fraction.
-                        __global float*     dt_simulation                             // Simulation time step.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
                         )
 {
   //////////////////////////////////////////////////////////////////////////////////////
@@ -71,6 +76,8 @@ __kernel void thekernel(__global float4*    color,
   float         V_est             = 0.0f;                                             // Neighbour rate strain (estimation).
   float         D                 = adjzero(dispersion[0]);                           // Dispersion.
   float         dt                = adjzero(dt_simulation[0]);                        // Simulation time step [s].
+  float         sigma             = adjzero(damping[n]);                              // Central node absorbing layer damping.
+  float3        Fabsorbing_est    = (float3)(0.0f, 0.0f, 0.0f);                       // Central node absorbing force (estimation).
 
   // COMPUTING STRIDE MINIMUM INDEX:
   if (i == 0)
@@ -116,7 +123,8 @@ __kernel void thekernel(__global float4*    color,
     }
   }
 
-  F_new = Fdirect + Fdissipative + Fviscous_est;                                      // Computing new total node force...
+  Fabsorbing_est = mulzero3(-sigma, v_est);                                           // Computing absorbing layer force (estimation)...
+  F_new = Fdirect + Fdissipative + Fviscous_est + Fabsorbing_est;                     // Computing new total node force...
   a_new = mulzero3(recipzero(m), F_new);                                              // Computing new acceleration...
   
   // APPLYING FREEDOM CONSTRAINTS:
@@ -0,0 +1,134 @@
+/// @file     spinor_kernel_7.cl
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    7th kernel.
+/// @details  Semi-implicit integrator: Jacobi sweep, reads velocity iterate from "velocity_est", writes it to "velocity_int".
+__kernel void thekernel(__global float4*    color,                                    // vec4(color.xyz [], alpha []).
+                        __global float4*    position,                                 // vec4(position.xyz [m], freedom []).
+                        __global float4*    velocity,                                 // vec4(velocity.xyz [m/s], friction [N*s/m]).
+                        __global float4*    velocity_int,                             // vec4(velocity (intermediate) [m/s], number of 1st + 2nd nearest neighbours []).
+                        __global float4*    velocity_est,                             // vec4(velocity.xyz (estimation) [m/s], radiative energy [J]).
+                        __global float4*    acceleration,                             // vec4(acceleration.xyz [m/s^2], mass [kg]).
+                        __global float*     stiffness,                                // Stiffness.
+                        __global float*     resting,                                  // Resting distance.
+                        __global int*       central,                                  // Central.
+                        __global int*       neighbour,                                // Neighbour.
+                        __global int*       offset,                                   // Offset.
+                        __global int*       spinor,                                   // Spinor.
+                        __global int*       spinor_num,                               // Spinor cells number.
+                        __global float4*    spinor_pos,                               // Spinor cells position.
+                        __global int*       frontier,                                 // Spacetime frontier.
+                        __global int*       frontier_num,                             // Spacetime frontier cells number.
+                        __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
+                        __global float*     dispersion,                               // Dispersion fraction.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
+                        )
+{
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////// INDEXES /////////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  unsigned int i = get_global_id(0);                                                  // Global index [#].
+  unsigned int j = 0;                                                                 // Neighbour stride index.
+  unsigned int j_min = 0;                                                             // Neighbour stride minimun index.
+  unsigned int j_max = offset[i];                                                     // Neighbour stride maximum index.
+  unsigned int k = 0;                                                                 // Neighbour tuple index.
+  unsigned int n = central[j_max - 1];                                                // Central node index.
+
+  //////////////////////////////////////////////////////////////////////////////////////
+  ///////////////////////////////////// CELL VARIABLES /////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  float         freedom           = adjzero(position[n].w);                           // Central node freedom flag.
+  float3        p                 = adjzero3(position[n].xyz);                        // Central node position.
+  float3        v                 = adjzero3(velocity[n].xyz);                        // Central node velocity.
+  float3        u                 = adjzero3(velocity_est[n].xyz);                    // Central node velocity (current iterate).
+  float3        u_new             = (float3)(0.0f, 0.0f, 0.0f);                       // Central node velocity (next iterate).
+  float         im                = recipzero(adjzero(acceleration[n].w));            // Central node inverse mass.
+  int           b_central         = adjzero(velocity_int[n].w);                       // Number of 1st + 2nd nearest neighbours at central node.
+  int           b_mate            = 0.0f;                                             // Number of 1st + 2nd nearest neighbours at neighbour node.
+  float         beta              = adjzero(velocity[n].w);                           // Central node friction.
+  float3        mate              = (float3)(0.0f, 0.0f, 0.0f);                       // Neighbour node position.
+  float3        rate              = (float3)(0.0f, 0.0f, 0.0f);                       // Neighbour node velocity (current iterate).
+  float3        link              = (float3)(0.0f, 0.0f, 0.0f);                       // Neighbour link.
+  float3        direction         = (float3)(0.0f, 0.0f, 0.0f);                       // Neighbour link direction.
+  float3        Adirect           = (float3)(0.0f, 0.0f, 0.0f);                       // Central node direct acceleration.
+  float3        Adissipative      = (float3)(0.0f, 0.0f, 0.0f);                       // Central node dissipative acceleration.
+  float3        Uimplicit         = (float3)(0.0f, 0.0f, 0.0f);                       // Central node implicit (stiffness + friction) velocity change.
+  float3        diagonal          = (float3)(1.0f, 1.0f, 1.0f);                       // Central node Jacobi diagonal (per axis) [].
+  float3        residual          = (float3)(0.0f, 0.0f, 0.0f);                       // Central node velocity residual.
+  float         Jacc_central      = adjzero(velocity_est[n].w);                       // Central node radiated energy.
+  float         Jacc_mate         = 0.0f;                                             // Neighbour node radiated energy.
+  float         JC                = 0.0f;                                             // Radiated energy density (central).
+  float         JN                = 0.0f;                                             // Radiated energy density (neighbour).
+  float         R                 = 0.0f;                                             // Neighbour link resting length.
+  float         K                 = 0.0f;                                             // Neighbour link stiffness (per unit mass).
+  float         S                 = 0.0f;                                             // Neighbour link strain.
+  float         L                 = 0.0f;                                             // Neighbour link length.
+  float         V                 = 0.0f;                                             // Neighbour rate strain (current iterate).
+  float         c                 = 0.0f;                                             // Neighbour link implicit coefficient (per unit mass) [].
+  float         D                 = adjzero(dispersion[0]);                           // Dispersion.
+  float         dt                = adjzero(dt_simulation[0]);                        // Simulation time step [s].
+  float         sigma             = mulzero(dt, mulzero(adjzero(damping[n]), im));    // Central node absorbing layer implicit coefficient [].
+
+  // COMPUTING STRIDE MINIMUM INDEX:
+  if (i == 0)
+  {
+    j_min = 0;                                                                        // Setting stride minimum (first stride)...
+  }
+  else
+  {
+    j_min = offset[i - 1];                                                            // Setting stride minimum (all others)...
+  }
+
+  // COMPUTING EXPLICIT ACCELERATION AND IMPLICIT OPERATOR (per unit mass, so that FLT_EPSILON truncations act on velocities):
+  for (j = j_min; j < j_max; j++)
+  {
+    k = neighbour[j];                                                                 // Computing neighbour index...
+    mate = adjzero3(position[k].xyz);                                                 // Getting neighbour position...
+    link = adjzero3(p - mate);                                                        // Computing neighbour link vector...
+    L = adjzero(length(link));                                                        // Computing neighbour link length...
+    direction = normzero3(link);                                                      // Computing neighbour link displacement vector...
+    rate = adjzero3(velocity_est[k].xyz);                                             // Getting neighbour velocity (current iterate)...
+    V = adjzero(dot(adjzero3(u - rate), direction));                                  // Computing neighbour rate (current iterate)...
+    Jacc_mate = adjzero(velocity_est[k].w);                                           // Radiant energy of neighbour node...
+    R = adjzero(resting[j]);                                                          // Getting neighbour link resting length...
+    S = adjzero(L - R);                                                               // Computing neighbour link strain...
+    K = mulzero(adjzero(stiffness[j]), im);                                           // Getting neighbour link stiffness (per unit mass)...
+    Adirect += mulzero3(adjzero(1.0f - fabs(D)), mulzero3(mulzero(K, -S), direction)); // Building up direct acceleration upon central node...
+    c = mulzero(dt, mulzero(beta, im)) + mulzero(0.5f*pownzero(dt, 2), mulzero(adjzero(1.0f - fabs(D)), K)); // Computing link implicit coefficient (dt*beta + dt^2*k/2)/m...
+    Uimplicit += mulzero3(mulzero(c, V), direction);                                  // Building up implicit operator upon current iterate...
+    diagonal += mulzero3(mulzero(c, fabs(direction.x) + fabs(direction.y) + fabs(direction.z)), fabs(direction)); // Building up Gershgorin diagonal...
+    b_mate = adjzero(velocity_int[k].w);                                              // Getting number of 1st + 2nd nearest neighbours...
+
+    if(adjzero(stiffness[j]) > FLT_EPSILON)
+    {
+      JC = mulzero(Jacc_central, recipzero(b_central));                               // Computing radiated energy density (central)...
+      JN = mulzero(Jacc_mate, recipzero(b_mate));                                     // Computing radiated energy density (neighbour)...
+      Adissipative += mulzero3(mulzero(mulzero(JC + JN, im), recipzero(R)), direction); // Building up acceleration from central node radiated energy...
+    }
+  }
+
+  // COMPUTING JACOBI ITERATE OF (1 + dt*sigma/m + (dt*beta + dt^2*k/2)/m)*u = v + dt*A, PER AXIS:
+  // each axis is divided by its row sum of absolute coefficients (Gershgorin bound), which keeps the
+  // iteration contractive for any dt, and the sweeps start from the velocity at the beginning of the
+  // step (kernel 5), so every partially converged iterate stays between "v" and the implicit solution.
+  Uimplicit += mulzero3(sigma, u);                                                    // Adding absorbing layer to implicit operator...
+  diagonal += (float3)(sigma, sigma, sigma);                                          // Adding absorbing layer to diagonal...
+  residual = v - u + mulzero3(dt, Adirect + Adissipative) - Uimplicit;                // Computing velocity residual...
+  u_new.x = u.x + mulzero(recipzero(diagonal.x), residual.x);                         // Computing next iterate (x-axis)...
+  u_new.y = u.y + mulzero(recipzero(diagonal.y), residual.y);                         // Computing next iterate (y-axis)...
+  u_new.z = u.z + mulzero(recipzero(diagonal.z), residual.z);                         // Computing next iterate (z-axis)...
+
+  // APPLYING FREEDOM CONSTRAINTS:
+  if (freedom < FLT_EPSILON)
+  {
+    u_new = (float3)(0.0f, 0.0f, 0.0f);                                               // Constraining next iterate...
+  }
+
+  // UPDATING KINEMATICS:
+  velocity_int[n].xyz = u_new;                                                        // Updating velocity iterate [m/s]...
+}
\ No newline at end of file
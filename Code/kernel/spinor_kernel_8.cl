@@ -0,0 +1,63 @@
+/// @file     spinor_kernel_8.cl
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    8th kernel.
+/// @details  Semi-implicit integrator: applies freedom contraints, updates velocity, acceleration and position from the last Jacobi iterate (spinor and frontier positions are set by kernel 12).
+__kernel void thekernel(__global float4*    color,                                    // vec4(color.xyz [], alpha []).
+                        __global float4*    position,                                 // vec4(position.xyz [m], freedom []).
+                        __global float4*    velocity,                                 // vec4(velocity.xyz [m/s], friction [N*s/m]).
+                        __global float4*    velocity_int,                             // vec4(velocity (intermediate) [m/s], number of 1st + 2nd nearest neighbours []).
+                        __global float4*    velocity_est,                             // vec4(velocity.xyz (estimation) [m/s], radiative energy [J]).
+                        __global float4*    acceleration,                             // vec4(acceleration.xyz [m/s^2], mass [kg]).
+                        __global float*     stiffness,                                // Stiffness.
+                        __global float*     resting,                                  // Resting distance.
+                        __global int*       central,                                  // Central.
+                        __global int*       neighbour,                                // Neighbour.
+                        __global int*       offset,                                   // Offset.
+                        __global int*       spinor,                                   // Spinor.
+                        __global int*       spinor_num,                               // Spinor cells number.
+                        __global float4*    spinor_pos,                               // Spinor cells position.
+                        __global int*       frontier,                                 // Spacetime frontier.
+                        __global int*       frontier_num,                             // Spacetime frontier cells number.
+                        __global float4*    frontier_pos,                             // Spacetime frontier cells posistion.
+                        __global float*     dispersion,                               // Dispersion fraction.
+                        __global float*     dt_simulation,                            // Simulation time step.
+                        __global float*     damping,                                  // Absorbing layer damping.
+                        __global float4*    position_bak,                             // vec4(position.xyz [m], freedom []) (step backup).
+                        __global float4*    velocity_bak,                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+                        __global float4*    acceleration_bak,                         // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+                        __global float*     monitor                                   // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
+                        )
+{
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////// INDICES /////////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  unsigned long i = get_global_id(0);                                                 // Global index [#].
+
+  //////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// CELL VARIABLES //////////////////////////////////
+  //////////////////////////////////////////////////////////////////////////////////////
+  float3        p                 = adjzero3(position[i].xyz);                        // Central node position.
+  float3        v                 = adjzero3(velocity[i].xyz);                        // Central node velocity.
+  float3        v_new             = adjzero3(velocity_int[i].xyz);                    // Central node velocity (new, last iterate).
+  float3        a_new             = (float3)(0.0f, 0.0f, 0.0f);                       // Central node acceleration (new).
+  float3        p_new             = (float3)(0.0f, 0.0f, 0.0f);                       // Central node position (new).
+  float         fr                = adjzero(position[i].w);                           // Central node freedom flag.
+  float         dt                = adjzero(dt_simulation[0]);                        // Simulation time step.
+
+  // APPLYING FREEDOM CONSTRAINTS:
+  if (fr < FLT_EPSILON)
+  {
+    v_new = (float3)(0.0f, 0.0f, 0.0f);                                               // Constraining new velocity...
+  }
+
+  // COMPUTING NEW POSITION:
+  a_new = mulzero3(recipzero(dt), v_new - v);                                         // Computing new acceleration...
+  p_new = p + mulzero3(dt, v_new);                                                    // Computing new position...
+
+  // UPDATING KINEMATICS:
+  position[i].xyz = p_new;                                                            // Updating new position...
+  velocity[i].xyz = v_new;                                                            // Updating velocity [m/s]...
+  velocity_int[i].xyz = v_new;                                                        // Updating intermediate velocity...
+  acceleration[i].xyz = a_new;                                                        // Updating acceleration [m/s^2]...
+}
\ No newline at end of file
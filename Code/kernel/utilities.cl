@@ -400,3 +400,23 @@ float3 colormap (float intensity)
 
     return (float3)(turbo_colormap[i]);
 }
+
+// Atomically sets *p to the maximum between *p and a non-negative float (positive floats order as their integer bits).
+void atomic_max_positive (volatile __global float* p, float v)
+{
+  atomic_max((volatile __global int*)p, as_int(v));                                 // Updating maximum...
+}
+
+// Atomically adds a float to *p (compare-and-swap loop).
+void atomic_add_float (volatile __global float* p, float v)
+{
+  float old_value;                                                                  // Old value.
+  float new_value;                                                                  // New value.
+
+  do
+  {
+    old_value = *p;                                                                 // Getting old value...
+    new_value = old_value + v;                                                      // Computing new value...
+  }
+  while(atomic_cmpxchg((volatile __global int*)p, as_int(old_value), as_int(new_value)) != as_int(old_value));
+}
@@ -0,0 +1,52 @@
+/// @file     grading.hpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    Lattice grading.
+/// @details  Shared by main.cpp (regrade) and by the host checks: identity inside the fine core
+///           around the spinor, sinh stretching outside. The size ratio of neighbouring cells tends
+///           to exp (grading*ds) far from the core, hence the grading rate is limited by GRADING_RATIO.
+
+#ifndef grading_hpp
+#define grading_hpp
+
+#include <cmath>
+
+#define GRADING_RATIO 1.25f                                                                          // Maximum size ratio of neighbouring cells [].
+
+/// Graded coordinate of the lattice coordinate "x".
+inline float graded_coordinate (float x, float r_core, float grading)
+{
+  if((grading <= 0.0f) || (std::fabs (x) < r_core))
+  {
+    return x;                                                                                        // Keeping fine core coordinate...
+  }
+
+  return std::copysign (r_core + std::sinh (grading*(std::fabs (x) - r_core))/grading, x);           // Stretching far field coordinate...
+}
+
+/// Graded to lattice spacing ratio at the lattice coordinate "x".
+inline float graded_stretch (float x, float r_core, float grading)
+{
+  if((grading <= 0.0f) || (std::fabs (x) < r_core))
+  {
+    return 1.0f;                                                                                     // Keeping fine core spacing...
+  }
+
+  return std::cosh (grading*(std::fabs (x) - r_core));                                               // Computing far field spacing ratio...
+}
+
+/// Link stiffness scale: the cell cross-section over the link length, i.e. the cell volume over the
+/// squared link length (hy*hz/hx for an x-axis link in a hx*hy*hz cell), relative to the lattice
+/// ones. It keeps the axial modulus of every link direction on stretched (non-cubic) cells.
+inline float graded_scale (float volume_a, float volume_b, float dV, float lattice_length, float graded_length)
+{
+  return 0.5f*(volume_a + volume_b)/dV*std::pow (lattice_length/graded_length, 2.0f);
+}
+
+/// Maximum grading rate [1/m] for the cell size "ds".
+inline float graded_rate_max (float ds)
+{
+  return std::log (GRADING_RATIO)/ds;
+}
+
+#endif
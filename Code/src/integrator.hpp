@@ -0,0 +1,67 @@
+/// @file     integrator.hpp
+/// @author   agent
+/// @date     18OCT2026
+/// @brief    Integrator limits and adaptive time step controller.
+/// @details  Shared by main.cpp (HUD clamps, frame acceptance) and by the host checks: integrator_check
+///           runs every Jacobi sweep count up to SWEEPS_MAX at time steps up to SAFETY_SI_MAX, and
+///           fails if any of them diverges; controller_check drives adapt() on the kernel mirror.
+
+#ifndef integrator_hpp
+#define integrator_hpp
+
+#include <cmath>
+#include <algorithm>
+
+#define SWEEPS_MAX    8                                                                              // Maximum Jacobi sweep pairs [#].
+#define SAFETY_SI_MAX 16.0f                                                                          // Maximum semi-implicit time step [dt_CFL].
+
+/// Adaptive time step controller, called once per frame with the monitor readings of the frame run at
+/// time step "dt" (maximum link strain increment and node travel per step, total energy at the end).
+/// Returns false, halving "dt" down to "dt_min", if the frame is to be restored and run again: a
+/// non-finite reading, a strain or travel increment above its maximum or, when the frame is not
+/// "driven", an energy drift above "drift_max". Otherwise accepts the frame energy and grows "dt" by
+/// 10% up to "dt_max" if the increments stayed below half their maximum. A frame already at "dt_min"
+/// is always accepted.
+inline bool adapt (
+                   float& dt,
+                   float  dt_min,
+                   float  dt_max,
+                   float  strain_step,
+                   float  travel_step,
+                   float  energy,
+                   float& energy_old,
+                   bool   driven,
+                   float  strain_max,
+                   float  travel_max,
+                   float  drift_max
+                  )
+{
+  if((dt > dt_min) &&
+     (
+      !std::isfinite (strain_step) ||
+      !std::isfinite (travel_step) ||
+      !std::isfinite (energy) ||
+      (strain_step > strain_max) ||
+      (travel_step > travel_max) ||
+      (!driven && (energy_old > 0.0f) && (energy > (1.0f + drift_max)*energy_old))
+     )
+    )
+  {
+    dt = std::max (0.5f*dt, dt_min);                                                                 // Halving time step...
+
+    return false;                                                                                    // Rejecting frame...
+  }
+
+  energy_old = energy;                                                                               // Accepting energy...
+
+  if((strain_step < 0.5f*strain_max) && (travel_step < 0.5f*travel_max))
+  {
+    dt = 1.1f*dt;                                                                                    // Growing time step...
+  }
+
+  dt = std::min (dt, dt_max);                                                                        // Clamping time step...
+
+  return true;                                                                                       // Accepting frame...
+}
+
+#endif
@@ -38,12 +38,23 @@
 #define KERNEL_2       "spinor_kernel_2.cl"                                                          // OpenCL kernel source.
 #define KERNEL_3       "spinor_kernel_3.cl"                                                          // OpenCL kernel source.
 #define KERNEL_4       "spinor_kernel_4.cl"                                                          // OpenCL kernel source.
+#define KERNEL_5       "spinor_kernel_5.cl"                                                          // OpenCL kernel source.
+#define KERNEL_6       "spinor_kernel_6.cl"                                                          // OpenCL kernel source.
+#define KERNEL_7       "spinor_kernel_7.cl"                                                          // OpenCL kernel source.
+#define KERNEL_8       "spinor_kernel_8.cl"                                                          // OpenCL kernel source.
+#define KERNEL_9       "spinor_kernel_9.cl"                                                          // OpenCL kernel source.
+#define KERNEL_10      "spinor_kernel_10.cl"                                                         // OpenCL kernel source.
+#define KERNEL_11      "spinor_kernel_11.cl"                                                         // OpenCL kernel source.
+#define KERNEL_12      "spinor_kernel_12.cl"                                                         // OpenCL kernel source.
+#define KERNEL_13      "spinor_kernel_13.cl"                                                         // OpenCL kernel source.
 #define UTILITIES      "utilities.cl"                                                                // OpenCL utilities source.
 #define MESH_FILE      "spacetime.msh"                                                               // GMSH mesh.
 #define MESH           GMSH_HOME MESH_FILE                                                           // GMSH mesh (full path).
 
 // INCLUDES:
 #include "nu.hpp"                                                                                    // Neutrino header file.
+#include "integrator.hpp"                                                                            // Integrator limits and adaptive time step controller.
+#include "grading.hpp"                                                                               // Lattice grading.
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////// MAIN /////////////////////////////////////////////////
@@ -76,6 +87,16 @@ int main ()
   nu::kernel*                      kernel_2       = new nu::kernel ();                               // OpenCL kernel array.
   nu::kernel*                      kernel_3       = new nu::kernel ();                               // OpenCL kernel array.
   nu::kernel*                      kernel_4       = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_5       = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_6       = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_7       = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_8       = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_9       = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_10      = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_11      = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_12      = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel*                      kernel_13      = new nu::kernel ();                               // OpenCL kernel array.
+  nu::kernel_mode                  sync           = nu::WAIT;                                        // OpenCL end of frame synchronization.
   nu::float4*                      color          = new nu::float4 (0);                              // vec4(color.xyz [], alpha []).
   nu::float4*                      position       = new nu::float4 (1);                              // vec4(position.xyz [m], freedom []).
   nu::float4*                      velocity       = new nu::float4 (2);                              // vec4(velocity.xyz [m/s], friction [N*s/m]).
@@ -95,6 +116,11 @@ int main ()
   nu::float4*                      frontier_pos   = new nu::float4 (16);                             // Frontier nodes position.
   nu::float1*                      dispersion     = new nu::float1 (17);                             // Dispersion fraction [-0.5...1.0].
   nu::float1*                      dt             = new nu::float1 (18);                             // Time step [s].
+  nu::float1*                      damping        = new nu::float1 (19);                             // Absorbing layer damping [kg/s].
+  nu::float4*                      position_bak   = new nu::float4 (20);                             // vec4(position.xyz [m], freedom []) (step backup).
+  nu::float4*                      velocity_bak   = new nu::float4 (21);                             // vec4(velocity.xyz [m/s], friction [N*s/m]) (step backup).
+  nu::float4*                      acceleration_bak = new nu::float4 (22);                           // vec4(acceleration.xyz [m/s^2], mass [kg]) (step backup).
+  nu::float1*                      monitor        = new nu::float1 (23);                             // Stability monitor (max strain rate [1/s], max speed [m/s], energy [J]).
 
   // IMGUI:
   nu::imgui*                       hud            = new nu::imgui ();                                // ImGui context.
@@ -123,12 +149,36 @@ int main ()
 
   // SIMULATION VARIABLES:
   float                            safety_CFL     = 0.5f;                                            // Courant-Friedrichs-Lewy safety coefficient [].
+  float                            safety_SI      = 8.0f;                                            // Semi-implicit time step coefficient (multiple of dt_CFL) [].
+  int                              sweeps         = 2;                                               // Semi-implicit Jacobi sweeps (pairs) [#].
+  int                              sweeps_old;                                                       // Jacobi sweep pairs (previous frame) [#].
+  bool                             semi_implicit  = false;                                           // Semi-implicit integrator flag.
+  int                              steps          = 1;                                               // Simulation steps per rendered frame [#].
+  int                              steps_old;                                                        // Steps per frame (previous frame) [#].
+  bool                             adaptive       = false;                                           // Adaptive time step flag.
+  bool                             accepted       = true;                                            // Adaptive time step frame acceptance flag.
+  bool                             driven         = true;                                            // External drive (spinor, frontier, parameters) flag.
+  float                            safety_max     = 0.6f;                                            // Adaptive explicit maximum time step coefficient [].
+  float                            safety_min     = 0.05f;                                           // Adaptive minimum time step coefficient [].
+  float                            strain_max     = 1.0E-2f;                                         // Maximum link strain increment per step [].
+  float                            travel_max     = 1.0E-1f;                                         // Maximum node travel per step [#cells].
+  float                            drift_max      = 1.0E-2f;                                         // Maximum energy drift per frame (undriven) [].
+  float                            strain_step    = 0.0f;                                            // Maximum link strain increment per step [].
+  float                            travel_step    = 0.0f;                                            // Maximum node travel per step [#cells].
+  float                            energy         = 0.0f;                                            // Total energy [J].
+  float                            energy_old     = 0.0f;                                            // Total energy (last accepted frame) [J].
+  float                            rejected       = 0.0f;                                            // Number of rejected frames [#].
+  float                            dt_min;                                                           // Adaptive minimum time step [s].
+  float                            dt_max;                                                           // Adaptive maximum time step [s].
   int                              N              = 3;                                               // Number of spatial dimensions of the MSM [].
   float                            rho            = 1.0E-2f;                                         // Mass density [kg/m^3].
   float                            E              = 1.0E-2f;                                         // Young's modulus [Pa];
   float                            nu             = 0.2f;                                            // Poisson's ratio [];
   float                            beta           = 1.0E-4f;                                         // Damping [kg*s*m].
   int                              R              = 3;                                               // Particle's radius [#cells].
+  float                            grading        = 0.0f;                                            // Lattice grading rate outside the fine core [1/m].
+  int                              layer          = 0;                                               // Absorbing layer thickness [#cells].
+  float                            absorption     = 1.0f;                                            // Absorbing layer peak damping (fraction of sqrt(k*dm)) [].
   float                            ds;                                                               // Cell size [m].
   float                            dV;                                                               // Cell volume [m^3].
   float                            k;                                                                // Spring constant [N/m].
@@ -145,6 +195,14 @@ int main ()
   float                            D;                                                                // Dispersion fraction [-0.5...1.0].
   float                            dt_CFL;                                                           // Courant-Friedrichs-Lewy critical time step [s].
   float                            dt_SIM;                                                           // Simulation time step [s].
+  float                            r_core;                                                           // Fine core half-width [m].
+  float                            r_max;                                                            // Domain half-width (graded) [m].
+  float                            r_lattice;                                                        // Lattice (uniform) half-width [m].
+  std::vector<float>               lattice;                                                          // Lattice (uniform) link lengths [m].
+  std::vector<nu_float4_structure> lattice_position;                                                 // Lattice (uniform) node positions [m].
+  std::vector<float>               node_volume;                                                      // Node volume (graded) [m^3].
+  std::vector<float>               link_scale;                                                       // Link stiffness scale (cell volume over squared link length) [].
+  std::vector<float>               depth;                                                            // Node depth from the frontier [#cells].
 
   // BACKUP:
   std::vector<nu_float4_structure> initial_position;                                                 // Backing up initial data...
@@ -153,7 +211,6 @@ int main ()
   std::vector<nu_float4_structure> initial_velocity_est;                                             // Backing up initial data...
   std::vector<nu_float4_structure> initial_acceleration;                                             // Backing up initial data...
   std::vector<nu_float4_structure> initial_spinor_pos;                                               // Backing up initial data...
-  std::vector<nu_float4_structure> initial_frontier_pos;                                             // Backing up initial data...
 
   // MESH:
   spacetime->process (VOLUME, N, nu::MSH_HEX_8);                                                     // Processing mesh...
@@ -181,20 +238,111 @@ int main ()
   v_p             = sqrt (abs (M/rho));                                                              // Computing speed of P-waves...
   v_s             = sqrt (abs (mu/rho));                                                             // Computing speed of S-waves...
   dt_CFL          = ds/(N*(v_p + v_s));                                                              // Computing Courant-Friedrichs-Lewy critical time step [s]...
-  dt_SIM          = safety_CFL*dt_CFL;                                                               // Setting simulation time step [s]...
+  dt_SIM          = (semi_implicit ? safety_SI : safety_CFL)*dt_CFL;                                 // Setting simulation time step [s]...
+
+  lattice          = resting->data;                                                                  // Backing up lattice link lengths...
+  lattice_position = position->data;                                                                 // Backing up lattice node positions...
+  r_lattice        = 0.0f;                                                                           // Resetting lattice half-width...
+
+  for(i = 0; i < nodes; i++)
+  {
+    px        = fabs (position->data[i].x);                                                          // Getting lattice x-distance from the origin...
+    py        = fabs (position->data[i].y);                                                          // Getting lattice y-distance from the origin...
+    pz        = fabs (position->data[i].z);                                                          // Getting lattice z-distance from the origin...
+    r_lattice = std::max ({r_lattice, px, py, pz});                                                  // Updating lattice half-width...
+  }
+
+  for(i = 0; i < nodes; i++)
+  {
+    px = fabs (position->data[i].x);                                                                 // Getting lattice x-distance from the origin...
+    py = fabs (position->data[i].y);                                                                 // Getting lattice y-distance from the origin...
+    pz = fabs (position->data[i].z);                                                                 // Getting lattice z-distance from the origin...
+    depth.push_back (round ((r_lattice - std::max ({px, py, pz}))/ds));                              // Computing node depth from the frontier...
+  }
+
+  node_volume.resize (nodes);                                                                        // Allocating node volumes...
+  link_scale.resize (neighbours);                                                                    // Allocating link stiffness scales...
+
+  // REGRADING LATTICE (from the lattice positions, for the current "R" and "grading"):
+  auto regrade    = [&]()
+  {
+    r_core = sqrt (3.0f)*ds*(R + 1) + ds;                                                            // Computing fine core half-width...
+    r_max  = 0.0f;                                                                                   // Resetting domain half-width...
+    layer  = std::clamp (layer, 0, (int)((r_lattice - r_core)/ds));                                  // Clamping absorbing layer (outside the fine core)...
+
+    for(i = 0; i < nodes; i++)
+    {
+      node_volume[i]      = (float)pow (ds, N)*
+                            graded_stretch (lattice_position[i].x, r_core, grading)*
+                            graded_stretch (lattice_position[i].y, r_core, grading)*
+                            graded_stretch (lattice_position[i].z, r_core, grading);                 // Computing node volume...
+      position->data[i].x = graded_coordinate (lattice_position[i].x, r_core, grading);              // Grading x-position...
+      position->data[i].y = graded_coordinate (lattice_position[i].y, r_core, grading);              // Grading y-position...
+      position->data[i].z = graded_coordinate (lattice_position[i].z, r_core, grading);              // Grading z-position...
+      r_max               = std::max (r_max, (float)fabs (position->data[i].x));                     // Updating domain half-width...
+    }
+
+    for(i = 0; i < neighbours; i++)
+    {
+      resting->data[i] = sqrt (
+                               pow (position->data[central->data[i]].x - position->data[neighbour->data[i]].x, 2) +
+                               pow (position->data[central->data[i]].y - position->data[neighbour->data[i]].y, 2) +
+                               pow (position->data[central->data[i]].z - position->data[neighbour->data[i]].z, 2)
+                              );                                                                     // Computing graded resting distance...
+      link_scale[i]    = graded_scale (
+                                       node_volume[central->data[i]],
+                                       node_volume[neighbour->data[i]],
+                                       dV,
+                                       lattice[i],
+                                       resting->data[i]
+                                      );                                                             // Computing link stiffness scale...
+    }
+  };
+
+  regrade ();                                                                                        // Grading lattice...
+
+  // ABSORBING LAYER (grounded damping, cubic from zero at depth == layer + 1 up to the 1st free shell):
+  // the frontier links of the layer are released, so that the damping of the 1st free shell, matched
+  // to the link impedance sqrt (k*dm), ends the lattice as an infinite chain would instead of the rigid
+  // frontier. A grounded damping in front of a rigid frontier reflects most of the waves longer than
+  // the layer (the frontier drive acts only without absorbing layer).
+  auto absorbing  = [&](size_t n) -> float
+  {
+    if((layer <= 0) || (depth[n] < 1.0f) || (depth[n] > layer))
+    {
+      return 0.0f;                                                                                   // Outside absorbing layer...
+    }
+
+    return absorption*sqrt (k*dm)*pow (node_volume[n]/dV, 2.0f/3.0f)*pow ((layer + 1 - depth[n])/layer, 3); // Computing layer damping...
+  };
+
+  auto anchoring  = [&](size_t n) -> float
+  {
+    if((layer > 0) && ((depth[central->data[n]] < 1.0f) != (depth[neighbour->data[n]] < 1.0f)))
+    {
+      return 0.0f;                                                                                   // Releasing frontier link...
+    }
+
+    return 1.0f;                                                                                     // Keeping link...
+  };
 
   // SETTING NEUTRINO ARRAYS (parameters):
   dispersion->data.push_back (D);                                                                    // Setting dispersion fraction...
   dt->data.push_back (dt_SIM);                                                                       // Setting time step...
+  monitor->data = {0.0f, 0.0f, 0.0f};                                                                // Resetting stability monitor...
 
   // SETTING NEUTRINO ARRAYS ("nodes" depending):
   for(i = 0; i < nodes; i++)
   {
     position->data[i].w = 1.0f;                                                                      // Setting freedom flag...
     velocity->data.push_back ({0.0f, 0.0f, 0.0f, beta});                                             // Setting velocity...
+    damping->data.push_back (absorbing (i));                                                         // Setting absorbing layer damping...
     velocity_int->data.push_back ({0.0f, 0.0f, 0.0f, 0.0f});                                         // Setting intermediate velocity...
     velocity_est->data.push_back ({0.0f, 0.0f, 0.0f, 0.0f});                                         // Setting estimated velocity...
-    acceleration->data.push_back ({0.0f, 0.0f, 0.0f, dm});                                           // Setting acceleration...
+    acceleration->data.push_back ({0.0f, 0.0f, 0.0f, rho*node_volume[i]});                           // Setting acceleration...
+    position_bak->data.push_back ({0.0f, 0.0f, 0.0f, 0.0f});                                         // Setting position backup...
+    velocity_bak->data.push_back ({0.0f, 0.0f, 0.0f, 0.0f});                                         // Setting velocity backup...
+    acceleration_bak->data.push_back ({0.0f, 0.0f, 0.0f, 0.0f});                                     // Setting acceleration backup...
 
     // Finding spinor:
     if(
@@ -224,25 +372,25 @@ int main ()
   for(i = 0; i < neighbours; i++)
   {
     // Building 3D isotropic 18-node cubic MSM:
-    if(resting->data[i] < (ds + 0.01f))
+    if(lattice[i] < (ds + 0.01f))
     {
-      stiffness->data.push_back (k);                                                                 // Setting 1st nearest neighbour link stiffness...
+      stiffness->data.push_back (k*link_scale[i]*anchoring (i));                                     // Setting 1st nearest neighbour link stiffness...
     }
-    if((resting->data[i] > (ds + 0.01f)) &&
-       (resting->data[i] < (sqrt (2.0f)*ds + 0.01f))
+    if((lattice[i] > (ds + 0.01f)) &&
+       (lattice[i] < (sqrt (2.0f)*ds + 0.01f))
       )
     {
-      stiffness->data.push_back (k);                                                                 // Setting 2nd nearest neighbour link stiffness...
+      stiffness->data.push_back (k*link_scale[i]*anchoring (i));                                     // Setting 2nd nearest neighbour link stiffness...
     }
-    if((resting->data[i] > (sqrt (2.0f)*ds + 0.01f)) &&
-       (resting->data[i] < (sqrt (3.0f)*ds + 0.01f))
+    if((lattice[i] > (sqrt (2.0f)*ds + 0.01f)) &&
+       (lattice[i] < (sqrt (3.0f)*ds + 0.01f))
       )
     {
       stiffness->data.push_back (0.0f);                                                              // Setting 3rd nearest neighbour link stiffness...
     }
 
     // Showing only 1st neighbours:
-    if(resting->data[i] < (ds + 0.01f))
+    if(lattice[i] < (ds + 0.01f))
     {
       color->data.push_back ({0.0f, 1.0f, 0.0f, 0.3f});                                              // Setting color...
     }
@@ -287,7 +435,6 @@ int main ()
   initial_velocity_int = velocity_int->data;                                                         // Setting backup data...
   initial_acceleration = acceleration->data;                                                         // Setting backup data...
   initial_spinor_pos   = spinor_pos->data;                                                           // Setting backup data...
-  initial_frontier_pos = frontier_pos->data;                                                         // Setting backup data...
 
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////// OPENCL KERNELS INITIALIZATION /////////////////////////////////
@@ -304,6 +451,33 @@ int main ()
   kernel_4->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                         // Setting kernel source file...
   kernel_4->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_4));                          // Setting kernel source file...
   kernel_4->build (nodes, 0, 0);                                                                     // Building kernel program...
+  kernel_5->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                         // Setting kernel source file...
+  kernel_5->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_5));                          // Setting kernel source file...
+  kernel_5->build (nodes, 0, 0);                                                                     // Building kernel program...
+  kernel_6->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                         // Setting kernel source file...
+  kernel_6->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_6));                          // Setting kernel source file...
+  kernel_6->build (nodes, 0, 0);                                                                     // Building kernel program...
+  kernel_7->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                         // Setting kernel source file...
+  kernel_7->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_7));                          // Setting kernel source file...
+  kernel_7->build (nodes, 0, 0);                                                                     // Building kernel program...
+  kernel_8->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                         // Setting kernel source file...
+  kernel_8->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_8));                          // Setting kernel source file...
+  kernel_8->build (nodes, 0, 0);                                                                     // Building kernel program...
+  kernel_9->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                         // Setting kernel source file...
+  kernel_9->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_9));                          // Setting kernel source file...
+  kernel_9->build (nodes, 0, 0);                                                                     // Building kernel program...
+  kernel_10->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                        // Setting kernel source file...
+  kernel_10->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_10));                        // Setting kernel source file...
+  kernel_10->build (nodes, 0, 0);                                                                    // Building kernel program...
+  kernel_11->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                        // Setting kernel source file...
+  kernel_11->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_11));                        // Setting kernel source file...
+  kernel_11->build (nodes, 0, 0);                                                                    // Building kernel program...
+  kernel_12->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                        // Setting kernel source file...
+  kernel_12->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_12));                        // Setting kernel source file...
+  kernel_12->build (nodes, 0, 0);                                                                    // Building kernel program...
+  kernel_13->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                        // Setting kernel source file...
+  kernel_13->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_13));                        // Setting kernel source file...
+  kernel_13->build (nodes, 0, 0);                                                                    // Building kernel program...
 
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////// OPENGL SHADERS INITIALIZATION /////////////////////////////////
@@ -329,10 +503,100 @@ int main ()
 
     cl->write (16);                                                                                  // Writing frontier position...
     cl->acquire ();                                                                                  // Acquiring variables...
-    cl->execute (kernel_1, nu::WAIT);                                                                // Executing OpenCL kernel...
-    cl->execute (kernel_2, nu::WAIT);                                                                // Executing OpenCL kernel...
-    cl->execute (kernel_3, nu::WAIT);                                                                // Executing OpenCL kernel...
-    cl->execute (kernel_4, nu::WAIT);                                                                // Executing OpenCL kernel...
+
+    if(adaptive)
+    {
+      cl->execute (kernel_9, nu::DONT_WAIT);                                                         // Backing up kinematics...
+    }
+
+    // ADAPTIVE TIME STEP (a frame violating the stability or energy drift bounds is restored and run
+    // again at half dt, until it is accepted or dt reaches dt_min; dt grows when the frame is quiet):
+    do
+    {
+      accepted = true;                                                                               // Accepting frame by default...
+
+      if(adaptive)
+      {
+        monitor->data = {0.0f, 0.0f, 0.0f};                                                          // Resetting stability monitor...
+        cl->write (23);                                                                              // Writing stability monitor...
+      }
+
+      for(j = 0; j < (GLuint)steps; j++)
+      {
+        sync = (j == ((GLuint)steps - 1)) ? nu::WAIT : nu::DONT_WAIT;                                // Setting end of frame synchronization...
+
+        if(semi_implicit)
+        {
+          // Semi-implicit step: constraints are applied first (as kernel 1 does on the explicit path),
+          // then link stiffness and friction are solved by Jacobi sweeps starting from the velocity at
+          // the beginning of the step, each sweep pair ping-pongs the velocity iterate between
+          // "velocity_int" and "velocity_est".
+          cl->execute (kernel_12, nu::DONT_WAIT);                                                    // Executing OpenCL kernel...
+          cl->execute (kernel_2, nu::DONT_WAIT);                                                     // Executing OpenCL kernel...
+          cl->execute (kernel_5, nu::DONT_WAIT);                                                     // Executing OpenCL kernel...
+
+          for(i = 0; i < (GLuint)sweeps; i++)
+          {
+            cl->execute (kernel_6, nu::DONT_WAIT);                                                   // Executing OpenCL kernel...
+            cl->execute (kernel_7, nu::DONT_WAIT);                                                   // Executing OpenCL kernel...
+          }
+
+          cl->execute (kernel_8, sync);                                                              // Executing OpenCL kernel...
+        }
+        else
+        {
+          cl->execute (kernel_1, nu::DONT_WAIT);                                                     // Executing OpenCL kernel...
+          cl->execute (kernel_2, nu::DONT_WAIT);                                                     // Executing OpenCL kernel...
+          cl->execute (kernel_3, nu::DONT_WAIT);                                                     // Executing OpenCL kernel...
+          cl->execute (kernel_4, sync);                                                              // Executing OpenCL kernel...
+        }
+
+        if(adaptive)
+        {
+          cl->execute (kernel_11, nu::DONT_WAIT);                                                    // Monitoring step...
+        }
+      }
+
+      if(adaptive)
+      {
+        cl->execute (kernel_13, nu::WAIT);                                                           // Monitoring frame energy...
+        cl->read (23);                                                                               // Reading stability monitor...
+
+        dt_max      = (semi_implicit ? safety_SI : safety_max)*dt_CFL;                               // Computing maximum time step...
+        dt_min      = safety_min*dt_CFL;                                                             // Computing minimum time step...
+        strain_step = monitor->data[0]*dt_SIM;                                                       // Computing maximum link strain increment per step...
+        travel_step = monitor->data[1]*dt_SIM/ds;                                                    // Computing maximum node travel per step...
+        energy      = monitor->data[2];                                                              // Getting total energy...
+
+        accepted    = adapt (
+                             dt_SIM,
+                             dt_min,
+                             dt_max,
+                             strain_step,
+                             travel_step,
+                             energy,
+                             energy_old,
+                             driven,
+                             strain_max,
+                             travel_max,
+                             drift_max
+                            );                                                                       // Judging frame...
+
+        if(accepted)
+        {
+          driven = false;                                                                            // Resetting external drive flag...
+        }
+        else
+        {
+          cl->execute (kernel_10, nu::WAIT);                                                         // Restoring kinematics...
+          rejected++;                                                                                // Counting rejected frames...
+        }
+
+        dt->data[0] = dt_SIM;                                                                        // Setting time step...
+        cl->write (18);                                                                              // Writing OpenCL data: dt...
+      }
+    } while(!accepted);
+
     cl->release ();                                                                                  // Releasing variables...
 
     gl->begin ();                                                                                    // Clearing gl...
@@ -343,16 +607,33 @@ int main ()
 
     hud->begin ();                                                                                   // Beginning HUD...
 
+    sweeps_old = sweeps;                                                                             // Backing up Jacobi sweep pairs...
+    steps_old  = steps;                                                                              // Backing up steps per frame...
+
     hud->window ("FREE LATTICE PARAMETERS", 400);                                                    // Creating window...
     hud->input ("Mass density:     ", "[kg/m^3]", "rho", &rho);                                      // Adding input parameter...
     hud->input ("Young's modulus:  ", "[Pa]    ", "Y", &E);                                          // Adding input parameter...
     hud->input ("Poisson's ratio:  ", "[]      ", "nu", &nu);                                        // Adding input parameter...
     hud->input ("Damping:          ", "[kg*s*m]", "beta", &beta);                                    // Adding input parameter...
     hud->input ("Particle's radius:", "[#cells]", "R", &R);                                          // Adding input parameter...
+    hud->input ("Grading:          ", "[1/m]   ", "grading", &grading);                              // Adding input parameter...
+    hud->input ("Absorbing layer:  ", "[#cells]", "layer", &layer);                                  // Adding input parameter...
+    hud->input ("Absorption:       ", "[]      ", "absorption", &absorption);                        // Adding input parameter...
+    hud->input ("Semi-implicit dt: ", "[dt_CFL]", "safety_SI", &safety_SI);                          // Adding input parameter...
+    hud->input ("Jacobi sweeps:    ", "[#pairs]", "sweeps", &sweeps);                                // Adding input parameter...
+    hud->input ("Steps per frame:  ", "[#]     ", "steps", &steps);                                  // Adding input parameter...
+    sweeps    = std::clamp (sweeps, 1, SWEEPS_MAX);                                                  // Clamping Jacobi sweeps (checked range)...
+    safety_SI = std::min (safety_SI, SAFETY_SI_MAX);                                                 // Clamping semi-implicit time step (checked range)...
+    grading   = std::clamp (grading, 0.0f, graded_rate_max (ds));                                    // Clamping grading (neighbouring cell size ratio)...
+    layer     = std::clamp (layer, 0, (int)((r_lattice - r_core)/ds));                               // Clamping absorbing layer (outside the fine core)...
+    steps     = std::max (steps, 1);                                                                 // Clamping steps per frame...
+    driven    = driven || (sweeps != sweeps_old) || (steps != steps_old);                            // Flagging external drive (integrator settings changed)...
 
 
     if(hud->button ("(U)pdate", 100) || gl->key_U)
     {
+      driven              = true;                                                                    // Flagging external drive...
+
       // RECOMPUTING LATTICE PARAMETERS:
       dV                  = (float)pow (ds, N);                                                      // Computing cell volume...
       dm                  = rho*dV;                                                                  // Computing node mass...
@@ -368,7 +649,7 @@ int main ()
       v_p                 = sqrt (abs (M/rho));                                                      // Computing speed of P-waves...
       v_s                 = sqrt (abs (mu/rho));                                                     // Computing speed of S-waves...
       dt_CFL              = ds/(N*(v_p + v_s));                                                      // Computing Courant-Friedrichs-Lewy critical time step [s]...
-      dt_SIM              = safety_CFL*dt_CFL;                                                       // Setting simulation time step [s]...
+      dt_SIM              = (semi_implicit ? safety_SI : safety_CFL)*dt_CFL;                         // Setting simulation time step [s]...
 
       // RECOMPUTING NEUTRINO ARRAYS (parameters):
       dispersion->data[0] = D;                                                                       // Setting dispersion fraction...
@@ -380,7 +661,8 @@ int main ()
       for(i = 0; i < nodes; i++)
       {
         velocity->data[i].w     = beta;                                                              // Setting friction...
-        acceleration->data[i].w = dm;                                                                // Setting mass...
+        damping->data[i]        = absorbing (i);                                                     // Setting absorbing layer damping...
+        acceleration->data[i].w = rho*node_volume[i];                                                // Setting mass...
 /*
         // Finding spinor:
         if(
@@ -411,18 +693,18 @@ int main ()
       for(i = 0; i < neighbours; i++)
       {
         // Building 3D isotropic 18-node cubic MSM:
-        if(resting->data[i] < (ds + 0.01f))
+        if(lattice[i] < (ds + 0.01f))
         {
-          stiffness->data[i] = k;                                                                    // Setting 1st nearest neighbour link stiffness...
+          stiffness->data[i] = k*link_scale[i]*anchoring (i);                                        // Setting 1st nearest neighbour link stiffness...
         }
-        if((resting->data[i] > (ds + 0.01f)) &&
-           (resting->data[i] < (sqrt (2.0f)*ds + 0.01f))
+        if((lattice[i] > (ds + 0.01f)) &&
+           (lattice[i] < (sqrt (2.0f)*ds + 0.01f))
           )
         {
-          stiffness->data[i] = k;                                                                    // Setting 2nd nearest neighbour link stiffness...
+          stiffness->data[i] = k*link_scale[i]*anchoring (i);                                        // Setting 2nd nearest neighbour link stiffness...
         }
-        if((resting->data[i] > (sqrt (2.0f)*ds + 0.01f)) &&
-           (resting->data[i] < (sqrt (3.0f)*ds + 0.01f))
+        if((lattice[i] > (sqrt (2.0f)*ds + 0.01f)) &&
+           (lattice[i] < (sqrt (3.0f)*ds + 0.01f))
           )
         {
           stiffness->data[i] = 0.0f;                                                                 // Setting 3rd nearest neighbour link stiffness...
@@ -434,6 +716,7 @@ int main ()
       cl->write (6);                                                                                 // Writing OpenCL data: stiffness...
       cl->write (17);                                                                                // Writing OpenCL data: dispersion...
       cl->write (18);                                                                                // Writing OpenCL data: dt...
+      cl->write (19);                                                                                // Writing OpenCL data: damping...
 
     }
 
@@ -441,6 +724,8 @@ int main ()
 
     if(hud->button ("(R)estart", 100) || gl->button_TRIANGLE || gl->key_R)
     {
+      driven              = true;                                                                    // Flagging external drive...
+
       // RECOMPUTING LATTICE PARAMETERS:
       dV                  = (float)pow (ds, N);                                                      // Computing cell volume...
       dm                  = rho*dV;                                                                  // Computing node mass...
@@ -456,7 +741,7 @@ int main ()
       v_p                 = sqrt (abs (M/rho));                                                      // Computing speed of P-waves...
       v_s                 = sqrt (abs (mu/rho));                                                     // Computing speed of S-waves...
       dt_CFL              = ds/(N*(v_p + v_s));                                                      // Computing Courant-Friedrichs-Lewy critical time step [s]...
-      dt_SIM              = safety_CFL*dt_CFL;                                                       // Setting simulation time step [s]...
+      dt_SIM              = (semi_implicit ? safety_SI : safety_CFL)*dt_CFL;                         // Setting simulation time step [s]...
 
       // RECOMPUTING NEUTRINO ARRAYS (parameters):
       dispersion->data[0] = D;                                                                       // Setting dispersion fraction...
@@ -468,7 +753,14 @@ int main ()
       velocity_int->data  = initial_velocity_int;                                                    // vec4(velocity.xyz (intermediate) [m/s], number of 1st + 2nd neighbours []).
       velocity_est->data  = initial_velocity_est;                                                    // vec4(velocity.xyz (intermediate) [m/s], number of 1st + 2nd neighbours []).
       acceleration->data  = initial_acceleration;                                                    // vec4(acceleration.xyz [m/s^2], mass [kg]).
-      frontier_pos->data  = initial_frontier_pos;                                                    // Frontier nodes position...
+
+      // REGRADING LATTICE (the fine core follows the current "R"):
+      regrade ();                                                                                    // Grading lattice...
+
+      for(j = 0; j < frontier_nodes; j++)
+      {
+        frontier_pos->data[j] = position->data[frontier->data[j]];                                   // Setting frontier position...
+      }
 
       // RECOMPUTING NEUTRINO ARRAYS ("nodes" depending):
       spinor->data.clear ();                                                                         // Deleting all spinor previous indices...
@@ -477,7 +769,8 @@ int main ()
       for(i = 0; i < nodes; i++)
       {
         velocity->data[i].w     = beta;                                                              // Setting friction...
-        acceleration->data[i].w = dm;                                                                // Setting mass...
+        damping->data[i]        = absorbing (i);                                                     // Setting absorbing layer damping...
+        acceleration->data[i].w = rho*node_volume[i];                                                // Setting mass...
 
         // Finding spinor:
         if(
@@ -506,18 +799,18 @@ int main ()
       for(i = 0; i < neighbours; i++)
       {
         // Building 3D isotropic 18-node cubic MSM:
-        if(resting->data[i] < (ds + 0.01f))
+        if(lattice[i] < (ds + 0.01f))
         {
-          stiffness->data[i] = k;                                                                    // Setting 1st nearest neighbour link stiffness...
+          stiffness->data[i] = k*link_scale[i]*anchoring (i);                                        // Setting 1st nearest neighbour link stiffness...
         }
-        if((resting->data[i] > (ds + 0.01f)) &&
-           (resting->data[i] < (sqrt (2.0f)*ds + 0.01f))
+        if((lattice[i] > (ds + 0.01f)) &&
+           (lattice[i] < (sqrt (2.0f)*ds + 0.01f))
           )
         {
-          stiffness->data[i] = k;                                                                    // Setting 2nd nearest neighbour link stiffness...
+          stiffness->data[i] = k*link_scale[i]*anchoring (i);                                        // Setting 2nd nearest neighbour link stiffness...
         }
-        if((resting->data[i] > (sqrt (2.0f)*ds + 0.01f)) &&
-           (resting->data[i] < (sqrt (3.0f)*ds + 0.01f))
+        if((lattice[i] > (sqrt (2.0f)*ds + 0.01f)) &&
+           (lattice[i] < (sqrt (3.0f)*ds + 0.01f))
           )
         {
           stiffness->data[i] = 0.0f;                                                                 // Setting 3rd nearest neighbour link stiffness...
@@ -531,12 +824,14 @@ int main ()
       cl->write (4);                                                                                 // vec4(velocity.xyz (estimation) [m/s], radiative energy [J])...
       cl->write (5);                                                                                 // vec4(acceleration.xyz [m/s^2], mass [kg])...
       cl->write (6);                                                                                 // Stiffness...
+      cl->write (7);                                                                                 // Resting distance...
       cl->write (11);                                                                                // Spinor...
       cl->write (12);                                                                                // Spinor cells number...
       cl->write (13);                                                                                // Spinor cells position...
       cl->write (16);                                                                                // Frontier nodes position...
       cl->write (17);                                                                                // Dispersion fraction [-0.5...1.0]...
       cl->write (18);                                                                                // Time step [s]...
+      cl->write (19);                                                                                // Absorbing layer damping [kg/s]...
     }
 
     hud->space (50);                                                                                 // Setting spacing...
@@ -555,6 +850,46 @@ int main ()
 
     hud->space (50);                                                                                 // Setting spacing...
 
+    if(hud->button ("e(X)plicit", 100) || gl->key_X)
+    {
+      driven        = true;                                                                          // Flagging external drive (integrator settings changed)...
+      semi_implicit = false;                                                                         // Setting explicit integrator...
+      dt_SIM        = safety_CFL*dt_CFL;                                                             // Setting simulation time step [s]...
+      dt->data[0]   = dt_SIM;                                                                        // Setting time step...
+      cl->write (18);                                                                                // Writing OpenCL data: dt...
+    }
+
+    hud->space (50);                                                                                 // Setting spacing...
+
+    if(hud->button ("(I)mplicit", 100) || gl->key_I)
+    {
+      driven        = true;                                                                          // Flagging external drive (integrator settings changed)...
+      semi_implicit = true;                                                                          // Setting semi-implicit integrator...
+      dt_SIM        = safety_SI*dt_CFL;                                                              // Setting simulation time step [s]...
+      dt->data[0]   = dt_SIM;                                                                        // Setting time step...
+      cl->write (18);                                                                                // Writing OpenCL data: dt...
+    }
+
+    hud->space (50);                                                                                 // Setting spacing...
+
+    if(hud->button ("(A)daptive", 100) || gl->key_A)
+    {
+      adaptive   = true;                                                                             // Setting adaptive time step...
+      energy_old = 0.0f;                                                                             // Resetting energy reference...
+    }
+
+    hud->space (50);                                                                                 // Setting spacing...
+
+    if(hud->button ("(F)ixed", 100) || gl->key_F)
+    {
+      adaptive    = false;                                                                           // Setting fixed time step...
+      dt_SIM      = (semi_implicit ? safety_SI : safety_CFL)*dt_CFL;                                 // Setting simulation time step [s]...
+      dt->data[0] = dt_SIM;                                                                          // Setting time step...
+      cl->write (18);                                                                                // Writing OpenCL data: dt...
+    }
+
+    hud->space (50);                                                                                 // Setting spacing...
+
     if(hud->button ("(E)xit", 100) || gl->button_CROSS || gl->key_E)
     {
       gl->close ();                                                                                  // Closing gl...
@@ -564,6 +899,8 @@ int main ()
 
     hud->window ("DERIVED LATTICE PARAMETER", 400);                                                  // Creating window...
     hud->output ("Cell size:                                  ", "[m]  ", "ds", ds);                 // Adding output parameter...
+    hud->output ("Fine core half-width:                       ", "[m]  ", "r_core", r_core);         // Adding output parameter...
+    hud->output ("Domain half-width:                          ", "[m]  ", "r_max", r_max);           // Adding output parameter...
     hud->output ("Cell volume:                                ", "[m^3]", "dV", dV);                 // Adding output parameter...
     hud->output ("Node mass:                                  ", "[kg] ", "dm", dm);                 // Adding output parameter...
     hud->output ("Spring constant:                            ", "[N/m]", "k", k);                   // Adding output parameter...
@@ -580,6 +917,10 @@ int main ()
     hud->output ("Courant-Friedrichs-Lewy critical time step: ", "[s]  ", "dt_CFL", dt_CFL);         // Adding output parameter...
     hud->output ("Courant-Friedrichs-Lewy safety coefficient: ", "[]   ", "safety_CFL", safety_CFL); // Adding output parameter...
     hud->output ("Simulation time step:                       ", "[s]  ", "dt_SIM", dt_SIM);         // Adding output parameter...
+    hud->output ("Maximum link strain increment per step:     ", "[]   ", "strain_step", strain_step); // Adding output parameter...
+    hud->output ("Maximum node travel per step:               ", "[#]  ", "travel_step", travel_step); // Adding output parameter...
+    hud->output ("Total energy:                               ", "[J]  ", "energy", energy);         // Adding output parameter...
+    hud->output ("Rejected frames:                            ", "[#]  ", "rejected", rejected);     // Adding output parameter...
     hud->finish ();                                                                                  // Finishing window...
 
     hud->end ();                                                                                     // Ending HUD...
@@ -587,6 +928,8 @@ int main ()
     // Reading gamepad buttons:
     if(gl->button_DPAD_LEFT || gl->key_LEFT)                                                         // Twist (z-axis, CCW)...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)spinor_num->data[0]; i++)
       {
         px                    = spinor_pos->data[i].x;                                               // Getting spinor x-position...
@@ -604,6 +947,8 @@ int main ()
 
     if(gl->button_DPAD_RIGHT || gl->key_RIGHT)                                                       // Twist (z-axis, CW)...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)spinor_num->data[0]; i++)
       {
         px                    = spinor_pos->data[i].x;                                               // Getting spinor x-position...
@@ -621,6 +966,8 @@ int main ()
 
     if(gl->button_DPAD_DOWN || gl->key_DOWN)                                                         // Twist (x-axis, CCW)...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)spinor_num->data[0]; i++)
       {
         py                    = spinor_pos->data[i].y;                                               // Getting spinor x-position...
@@ -636,6 +983,8 @@ int main ()
 
     if(gl->button_DPAD_UP || gl->key_UP)                                                             // Twist (x-axis, CW)...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)spinor_num->data[0]; i++)
       {
         py                    = spinor_pos->data[i].y;                                               // Getting spinor x-position...
@@ -651,6 +1000,8 @@ int main ()
 
     if(gl->button_LEFT_BUMPER || gl->key_O)                                                          // Spinor compression...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)spinor_num->data[0]; i++)
       {
         px                    = spinor_pos->data[i].x;                                               // Getting spinor x-position...
@@ -669,6 +1020,8 @@ int main ()
 
     if(gl->button_RIGHT_BUMPER || gl->key_P)                                                         // Spinor expansion...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)spinor_num->data[0]; i++)
       {
         px                    = spinor_pos->data[i].x;                                               // Getting spinor x-position...
@@ -687,6 +1040,8 @@ int main ()
 
     if(gl->button_SQUARE || gl->key_Q)                                                               // Boundary compression...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)frontier_num->data[0]; i++)
       {
         px                      = frontier_pos->data[i].x;                                           // Getting frontier x-position...
@@ -707,6 +1062,8 @@ int main ()
 
     if(gl->button_CIRCLE || gl->key_W)                                                               // Frontier expansion...
     {
+      driven = true;                                                                                 // Flagging external drive...
+
       for(i = 0; i < (GLuint)frontier_num->data[0]; i++)
       {
         px                      = frontier_pos->data[i].x;                                           // Getting frontier x-position...
@@ -753,10 +1110,24 @@ int main ()
   delete frontier_num;                                                                               // Deleting frontier_num...
   delete frontier_pos;                                                                               // Deleting frontier_pos...
   delete dt;                                                                                         // Deleting time step data...
+  delete damping;                                                                                    // Deleting absorbing layer damping data...
+  delete position_bak;                                                                               // Deleting position backup data...
+  delete velocity_bak;                                                                               // Deleting velocity backup data...
+  delete acceleration_bak;                                                                           // Deleting acceleration backup data...
+  delete monitor;                                                                                    // Deleting stability monitor data...
   delete kernel_1;                                                                                   // Deleting OpenCL kernel...
   delete kernel_2;                                                                                   // Deleting OpenCL kernel...
   delete kernel_3;                                                                                   // Deleting OpenCL kernel...
   delete kernel_4;                                                                                   // Deleting OpenCL kernel...
+  delete kernel_5;                                                                                   // Deleting OpenCL kernel...
+  delete kernel_6;                                                                                   // Deleting OpenCL kernel...
+  delete kernel_7;                                                                                   // Deleting OpenCL kernel...
+  delete kernel_8;                                                                                   // Deleting OpenCL kernel...
+  delete kernel_9;                                                                                   // Deleting OpenCL kernel...
+  delete kernel_10;                                                                                  // Deleting OpenCL kernel...
+  delete kernel_11;                                                                                  // Deleting OpenCL kernel...
+  delete kernel_12;                                                                                  // Deleting OpenCL kernel...
+  delete kernel_13;                                                                                  // Deleting OpenCL kernel...
   delete shader_1;                                                                                   // Deleting OpenGL shader...
   delete spacetime;                                                                                  // Deleting spacetime mesh...
 